@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "kine::kine" for configuration "Release"
+set_property(TARGET kine::kine APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(kine::kine PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libkine.a"
+  )
+
+list(APPEND _cmake_import_check_targets kine::kine )
+list(APPEND _cmake_import_check_files_for_kine::kine "${_IMPORT_PREFIX}/lib/libkine.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
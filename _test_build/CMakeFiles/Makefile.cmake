@@ -0,0 +1,88 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/config.cmake.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/tmp/catch2shim/lib/cmake/Catch2/Catch2Config.cmake"
+  "/tmp/catch2shim/lib/cmake/Catch2/Catch2ConfigVersion.cmake"
+  "/tmp/catch2shim/lib/cmake/Eigen/EigenConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/eigen3/cmake/Eigen3Config.cmake"
+  "/usr/share/eigen3/cmake/Eigen3ConfigVersion.cmake"
+  "/usr/share/eigen3/cmake/Eigen3Targets.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "kine-config.cmake"
+  "kine-config-version.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/catch2shim_main.dir/DependInfo.cmake"
+  "src/CMakeFiles/kine.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_fkplan.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_static_kine.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sincos.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_shared_kine.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_batch_ik.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_seed_cache.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_workspace_index.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_dls_allocations.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_jacobian_solvers.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_multistart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_iksolver.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_ccd_solver.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_fabrik_solver.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_analytical_solver.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_ik_budget.dir/DependInfo.cmake"
+  )
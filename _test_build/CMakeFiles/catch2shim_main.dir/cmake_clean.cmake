@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/catch2shim_main.dir/tmp/catch2shim/main.cpp.o"
+  "CMakeFiles/catch2shim_main.dir/tmp/catch2shim/main.cpp.o.d"
+  "libcatch2shim_main.a"
+  "libcatch2shim_main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/catch2shim_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
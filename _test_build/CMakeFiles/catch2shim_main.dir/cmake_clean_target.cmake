@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libcatch2shim_main.a"
+)
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/kine/FKPlan.cpp" "src/CMakeFiles/kine.dir/kine/FKPlan.cpp.o" "gcc" "src/CMakeFiles/kine.dir/kine/FKPlan.cpp.o.d"
+  "/root/repo/src/kine/WorkStealingPool.cpp" "src/CMakeFiles/kine.dir/kine/WorkStealingPool.cpp.o" "gcc" "src/CMakeFiles/kine.dir/kine/WorkStealingPool.cpp.o.d"
+  "/root/repo/src/kine/ik/WorkspaceIndex.cpp" "src/CMakeFiles/kine.dir/kine/ik/WorkspaceIndex.cpp.o" "gcc" "src/CMakeFiles/kine.dir/kine/ik/WorkspaceIndex.cpp.o.d"
+  "/root/repo/src/kine/math/Euler.cpp" "src/CMakeFiles/kine.dir/kine/math/Euler.cpp.o" "gcc" "src/CMakeFiles/kine.dir/kine/math/Euler.cpp.o.d"
+  "/root/repo/src/kine/math/MathUtils.cpp" "src/CMakeFiles/kine.dir/kine/math/MathUtils.cpp.o" "gcc" "src/CMakeFiles/kine.dir/kine/math/MathUtils.cpp.o.d"
+  "/root/repo/src/kine/math/Matrix4.cpp" "src/CMakeFiles/kine.dir/kine/math/Matrix4.cpp.o" "gcc" "src/CMakeFiles/kine.dir/kine/math/Matrix4.cpp.o.d"
+  "/root/repo/src/kine/math/Quaternion.cpp" "src/CMakeFiles/kine.dir/kine/math/Quaternion.cpp.o" "gcc" "src/CMakeFiles/kine.dir/kine/math/Quaternion.cpp.o.d"
+  "/root/repo/src/kine/math/SinCos.cpp" "src/CMakeFiles/kine.dir/kine/math/SinCos.cpp.o" "gcc" "src/CMakeFiles/kine.dir/kine/math/SinCos.cpp.o.d"
+  "/root/repo/src/kine/math/Vector3.cpp" "src/CMakeFiles/kine.dir/kine/math/Vector3.cpp.o" "gcc" "src/CMakeFiles/kine.dir/kine/math/Vector3.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
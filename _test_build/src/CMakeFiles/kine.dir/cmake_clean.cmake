@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kine.dir/kine/FKPlan.cpp.o"
+  "CMakeFiles/kine.dir/kine/FKPlan.cpp.o.d"
+  "CMakeFiles/kine.dir/kine/WorkStealingPool.cpp.o"
+  "CMakeFiles/kine.dir/kine/WorkStealingPool.cpp.o.d"
+  "CMakeFiles/kine.dir/kine/ik/WorkspaceIndex.cpp.o"
+  "CMakeFiles/kine.dir/kine/ik/WorkspaceIndex.cpp.o.d"
+  "CMakeFiles/kine.dir/kine/math/Euler.cpp.o"
+  "CMakeFiles/kine.dir/kine/math/Euler.cpp.o.d"
+  "CMakeFiles/kine.dir/kine/math/MathUtils.cpp.o"
+  "CMakeFiles/kine.dir/kine/math/MathUtils.cpp.o.d"
+  "CMakeFiles/kine.dir/kine/math/Matrix4.cpp.o"
+  "CMakeFiles/kine.dir/kine/math/Matrix4.cpp.o.d"
+  "CMakeFiles/kine.dir/kine/math/Quaternion.cpp.o"
+  "CMakeFiles/kine.dir/kine/math/Quaternion.cpp.o.d"
+  "CMakeFiles/kine.dir/kine/math/SinCos.cpp.o"
+  "CMakeFiles/kine.dir/kine/math/SinCos.cpp.o.d"
+  "CMakeFiles/kine.dir/kine/math/Vector3.cpp.o"
+  "CMakeFiles/kine.dir/kine/math/Vector3.cpp.o.d"
+  "libkine.a"
+  "libkine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_analytical_solver"
+  "../bin/test_analytical_solver.pdb"
+  "CMakeFiles/test_analytical_solver.dir/test_analytical_solver.cpp.o"
+  "CMakeFiles/test_analytical_solver.dir/test_analytical_solver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_analytical_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_batch_ik"
+  "../bin/test_batch_ik.pdb"
+  "CMakeFiles/test_batch_ik.dir/test_batch_ik.cpp.o"
+  "CMakeFiles/test_batch_ik.dir/test_batch_ik.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_batch_ik.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_ccd_solver"
+  "../bin/test_ccd_solver.pdb"
+  "CMakeFiles/test_ccd_solver.dir/test_ccd_solver.cpp.o"
+  "CMakeFiles/test_ccd_solver.dir/test_ccd_solver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ccd_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_dls_allocations"
+  "../bin/test_dls_allocations.pdb"
+  "CMakeFiles/test_dls_allocations.dir/test_dls_allocations.cpp.o"
+  "CMakeFiles/test_dls_allocations.dir/test_dls_allocations.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dls_allocations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/test_fabrik_solver.cpp" "tests/CMakeFiles/test_fabrik_solver.dir/test_fabrik_solver.cpp.o" "gcc" "tests/CMakeFiles/test_fabrik_solver.dir/test_fabrik_solver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/CMakeFiles/kine.dir/DependInfo.cmake"
+  "/root/repo/_test_build/CMakeFiles/catch2shim_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
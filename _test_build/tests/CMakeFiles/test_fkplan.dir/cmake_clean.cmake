@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_fkplan"
+  "../bin/test_fkplan.pdb"
+  "CMakeFiles/test_fkplan.dir/test_fkplan.cpp.o"
+  "CMakeFiles/test_fkplan.dir/test_fkplan.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_fkplan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
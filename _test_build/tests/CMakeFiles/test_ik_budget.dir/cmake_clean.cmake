@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_ik_budget"
+  "../bin/test_ik_budget.pdb"
+  "CMakeFiles/test_ik_budget.dir/test_ik_budget.cpp.o"
+  "CMakeFiles/test_ik_budget.dir/test_ik_budget.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ik_budget.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
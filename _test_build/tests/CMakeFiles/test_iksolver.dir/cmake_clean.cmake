@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_iksolver"
+  "../bin/test_iksolver.pdb"
+  "CMakeFiles/test_iksolver.dir/test_iksolver.cpp.o"
+  "CMakeFiles/test_iksolver.dir/test_iksolver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_iksolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_jacobian_solvers"
+  "../bin/test_jacobian_solvers.pdb"
+  "CMakeFiles/test_jacobian_solvers.dir/test_jacobian_solvers.cpp.o"
+  "CMakeFiles/test_jacobian_solvers.dir/test_jacobian_solvers.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_jacobian_solvers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_multistart"
+  "../bin/test_multistart.pdb"
+  "CMakeFiles/test_multistart.dir/test_multistart.cpp.o"
+  "CMakeFiles/test_multistart.dir/test_multistart.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_multistart.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_shared_kine"
+  "../bin/test_shared_kine.pdb"
+  "CMakeFiles/test_shared_kine.dir/test_shared_kine.cpp.o"
+  "CMakeFiles/test_shared_kine.dir/test_shared_kine.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_shared_kine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_sincos"
+  "../bin/test_sincos.pdb"
+  "CMakeFiles/test_sincos.dir/test_sincos.cpp.o"
+  "CMakeFiles/test_sincos.dir/test_sincos.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sincos.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_workspace_index"
+  "../bin/test_workspace_index.pdb"
+  "CMakeFiles/test_workspace_index.dir/test_workspace_index.cpp.o"
+  "CMakeFiles/test_workspace_index.dir/test_workspace_index.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_workspace_index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_test_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_fkplan]=] "/root/repo/_test_build/bin/test_fkplan")
+set_tests_properties([=[test_fkplan]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;15;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_static_kine]=] "/root/repo/_test_build/bin/test_static_kine")
+set_tests_properties([=[test_static_kine]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;16;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_sincos]=] "/root/repo/_test_build/bin/test_sincos")
+set_tests_properties([=[test_sincos]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;17;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_shared_kine]=] "/root/repo/_test_build/bin/test_shared_kine")
+set_tests_properties([=[test_shared_kine]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;18;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_batch_ik]=] "/root/repo/_test_build/bin/test_batch_ik")
+set_tests_properties([=[test_batch_ik]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;19;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_seed_cache]=] "/root/repo/_test_build/bin/test_seed_cache")
+set_tests_properties([=[test_seed_cache]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;20;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_workspace_index]=] "/root/repo/_test_build/bin/test_workspace_index")
+set_tests_properties([=[test_workspace_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;21;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_dls_allocations]=] "/root/repo/_test_build/bin/test_dls_allocations")
+set_tests_properties([=[test_dls_allocations]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;23;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_jacobian_solvers]=] "/root/repo/_test_build/bin/test_jacobian_solvers")
+set_tests_properties([=[test_jacobian_solvers]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;25;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_multistart]=] "/root/repo/_test_build/bin/test_multistart")
+set_tests_properties([=[test_multistart]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;27;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_iksolver]=] "/root/repo/_test_build/bin/test_iksolver")
+set_tests_properties([=[test_iksolver]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;28;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_ccd_solver]=] "/root/repo/_test_build/bin/test_ccd_solver")
+set_tests_properties([=[test_ccd_solver]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;29;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_fabrik_solver]=] "/root/repo/_test_build/bin/test_fabrik_solver")
+set_tests_properties([=[test_fabrik_solver]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;30;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_analytical_solver]=] "/root/repo/_test_build/bin/test_analytical_solver")
+set_tests_properties([=[test_analytical_solver]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;31;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[test_ik_budget]=] "/root/repo/_test_build/bin/test_ik_budget")
+set_tests_properties([=[test_ik_budget]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/CMakeLists.txt;32;add_test_executable;/root/repo/tests/CMakeLists.txt;0;")
@@ -23,6 +23,7 @@ struct MyUI: ImguiContext {
 
     Vector3 pos;
     std::vector<float> values;
+    kine::IKResult result;
 
     explicit MyUI(const Canvas& canvas, const kine::Kine& kine)
         : ImguiContext(canvas.windowPtr()),
@@ -37,6 +38,11 @@ struct MyUI: ImguiContext {
         solverNames_.emplace_back("DNN");
 #endif
 
+        // solving runs inside the render loop, never let it stall a frame
+        for (auto& solver : solvers_) {
+            solver->setBudget({std::chrono::milliseconds(2)});
+        }
+
         pos.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values).elements);
     }
 
@@ -76,6 +82,9 @@ struct MyUI: ImguiContext {
 
         jointMode = !posMode;
 
+        ImGui::Text("IK %s, residual %.4f, %u iterations, %.0f us", result.converged() ? "converged" : "not converged",
+                    result.residual, result.iterations, std::chrono::duration<float, std::micro>(result.wallTime).count());
+
         ImGui::Checkbox("controller", &enableController);
 
         ImGui::End();
@@ -223,7 +232,8 @@ int main() {
                 targetHelper->visible = false;
             }
             if (ui.posMode) {
-                ui.values = ui.getSelectedSolver().solveIK(kine, ui.pos, inDegrees(crane->getValues()));
+                ui.result = ui.getSelectedSolver().solveIKDetailed(kine, ui.pos, inDegrees(crane->getValues()));
+                ui.values = ui.result.values;
                 targetHelper->visible = true;
             }
 
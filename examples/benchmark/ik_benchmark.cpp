@@ -0,0 +1,127 @@
+
+#include "kine/Kine.hpp"
+#include "kine/ik/AnalyticalSolver.hpp"
+#include "kine/ik/CCDSolver.hpp"
+#include "kine/ik/DLSSolver.hpp"
+#include "kine/ik/FABRIKSolver.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kine;
+
+namespace {
+
+    constexpr int numTargets = 200;
+    constexpr float tolerance = 0.01f;
+
+    // Reachable targets, the end-effector positions of random configurations
+    std::vector<Vector3> generateTargets(const Kine& kine) {
+
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(0.05f, 0.95f);
+
+        std::vector<Vector3> targets(numTargets);
+        std::vector<float> values(kine.numDof());
+        for (auto& target : targets) {
+            for (auto& v : values) v = dist(gen);
+            target.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values, true));
+        }
+
+        return targets;
+    }
+
+    void benchmark(const std::string& name, IKSolver& solver, const Kine& kine, const std::vector<Vector3>& targets) {
+
+        const auto start = kine.meanAngles();
+
+        int solved = 0;
+        double error = 0;
+        Vector3 pos;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (const auto& target : targets) {
+            const auto values = solver.solveIK(kine, target, start);
+            pos.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values));
+            const float d = pos.distanceTo(target);
+            error += d;
+            if (d < tolerance) ++solved;
+        }
+        const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+
+        std::cout << "  " << std::left << std::setw(8) << name
+                  << std::right << std::setw(4) << solved << "/" << targets.size() << " solved"
+                  << std::setw(12) << error / targets.size() << " mean error"
+                  << std::setw(10) << std::fixed << std::setprecision(1) << elapsed / targets.size() << " us/solve"
+                  << std::defaultfloat << std::setprecision(6) << std::endl;
+    }
+
+    // Crane3R
+    Kine crane() {
+        return KineBuilder()
+                .addRevoluteJoint(Vector3::Y(), {-90.f, 90.f})
+                .addLink(Vector3::Y() * 4.2)
+                .addRevoluteJoint(Vector3::X(), {-80.f, 0.f})
+                .addLink(Vector3::Z() * 7)
+                .addRevoluteJoint(Vector3::X(), {40.f, 140.f})
+                .addLink(Vector3::Z() * 5.2)
+                .build();
+    }
+
+    // Slewing base followed by alternating pitch and roll joints
+    Kine arm7() {
+        KineBuilder builder;
+        builder.addRevoluteJoint(Vector3::Y(), {-180.f, 180.f}).addLink(Vector3::Y());
+        for (int i = 0; i < 6; ++i) {
+            builder.addRevoluteJoint(i % 2 ? Vector3::X() : Vector3::Z(), {-90.f, 90.f}).addLink(Vector3::Y() * 0.6);
+        }
+        return builder.build();
+    }
+
+    // Long boom of short segments with a telescopic section halfway
+    Kine boom20() {
+        KineBuilder builder;
+        builder.addRevoluteJoint(Vector3::Y(), {-180.f, 180.f}).addLink(Vector3::Y() * 0.5);
+        for (int i = 0; i < 19; ++i) {
+            if (i == 9) {
+                builder.addPrismaticJoint(Vector3::Y(), {0.f, 0.5f});
+            } else {
+                builder.addRevoluteJoint(i % 3 ? Vector3::X() : Vector3::Z(), {-45.f, 45.f});
+            }
+            builder.addLink(Vector3::Y() * 0.3);
+        }
+        return builder.build();
+    }
+
+}// namespace
+
+int main() {
+
+    std::vector<std::pair<std::string, Kine>> chains;
+    chains.emplace_back("3-DOF crane", crane());
+    chains.emplace_back("7-DOF arm", arm7());
+    chains.emplace_back("20-DOF boom", boom20());
+
+    for (const auto& [name, kine] : chains) {
+
+        std::cout << name << std::endl;
+
+        const auto targets = generateTargets(kine);
+
+        FABRIKSolver fabrik;
+        CCDSolver ccd;
+        DLSSolver dls;
+        benchmark("FABRIK", fabrik, kine, targets);
+        benchmark("CCD", ccd, kine, targets);
+        benchmark("DLS", dls, kine, targets);
+
+        if (AnalyticalSolver::supports(kine)) {
+            AnalyticalSolver analytical;
+            benchmark("Analytic", analytical, kine, targets);
+        }
+    }
+}
@@ -23,7 +23,7 @@ std::vector<float> generateRandomVector(size_t len) {
     return result;
 }
 
-void generateTrainingData(const kine::Kine& kine, const std::filesystem::path& positionsFile, const std::filesystem::path& anglesFile, int numSamples) {
+void generateTrainingData(const kine::Kine& kine, const std::filesystem::path& positionsFile, const std::filesystem::path& anglesFile, size_t numSamples) {
     std::ofstream posFile(positionsFile);
     std::ofstream angFile(anglesFile);
 
@@ -32,17 +32,29 @@ void generateTrainingData(const kine::Kine& kine, const std::filesystem::path& p
         return;
     }
 
+    constexpr size_t batchSize = 4096;
+    const size_t numDof = kine.numDof();
+    const auto& limits = kine.limits();
+
     kine::Vector3 pos;
-    for (int i = 0; i < numSamples; ++i) {
-        // Generate random joint angles
-        std::vector<float> normalizedAngles = generateRandomVector(kine.numDof());
-        const auto denormalizedAngles = kine.denormalizeValues(normalizedAngles);
-        angFile << denormalizedAngles[0] << "," << denormalizedAngles[1] << "," << denormalizedAngles[2] << "\n";
-
-        // Compute end-effector position
-        auto transformation = kine.calculateEndEffectorTransformation(denormalizedAngles, false);
-        pos.setFromMatrixPosition(transformation);
-        posFile << pos.x << "," << pos.y << "," << pos.z << "\n";
+    std::vector<kine::Matrix4> transformations(batchSize);
+    for (size_t offset = 0; offset < numSamples; offset += batchSize) {
+        const size_t n = std::min(batchSize, numSamples - offset);
+
+        // Generate random joint angles, joint j of sample i is stored at j * n + i
+        const std::vector<float> normalizedAngles = generateRandomVector(numDof * n);
+
+        // Compute end-effector positions for the whole batch
+        kine.calculateEndEffectorTransformations(normalizedAngles, std::span(transformations).first(n), true);
+
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < numDof; ++j) {
+                angFile << limits[j].denormalize(normalizedAngles[j * n + i]) << (j + 1 < numDof ? "," : "\n");
+            }
+
+            pos.setFromMatrixPosition(transformations[i]);
+            posFile << pos.x << "," << pos.y << "," << pos.z << "\n";
+        }
     }
 
     posFile.close();
@@ -72,5 +72,6 @@ torch.onnx.export(
     opset_version=11,  # ONNX opset version
     do_constant_folding=True,  # Optimize constant folding for inference
     input_names=["input"],  # Name of the input layer
-    output_names=["output"]  # Name of the output layer
+    output_names=["output"],  # Name of the output layer
+    dynamic_axes={"input": {0: "batch"}, "output": {0: "batch"}}  # Allow batched inference
 )
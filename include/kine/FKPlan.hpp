@@ -0,0 +1,323 @@
+
+#ifndef KINE_FKPLAN_HPP
+#define KINE_FKPLAN_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "kine/KineComponent.hpp"
+#include "kine/math/MathUtils.hpp"
+#include "kine/math/Matrix4.hpp"
+#include "kine/math/RigidTransform.hpp"
+#include "kine/math/SinCos.hpp"
+#include "kine/math/Vector3.hpp"
+
+#include "kine/joints/PrismaticJoint.hpp"
+#include "kine/joints/RevoluteJoint.hpp"
+
+namespace kine {
+
+    // A flat, contiguous representation of a kinematic chain.
+    // Compiled once from the list of KineComponents, evaluating it requires no virtual calls, RTTI or heap allocations.
+    // Each step applies the motion of its joint (if any) followed by its constant transformation (if any).
+    class FKPlan {
+
+    public:
+        enum class StepType {
+            Fixed,
+            Revolute,
+            Prismatic
+        };
+
+        struct Step {
+            StepType type{StepType::Fixed};
+            // joint axis, unused for fixed steps
+            Vector3 axis;
+            // principal axis index the joint axis is aligned with or -1, see KineJoint::principalAxis
+            int principalAxis{-1};
+            float principalAxisSign{1};
+            // joint limits, resolved to finite bounds used for denormalization
+            float lower{};
+            float upper{};
+            // constant transformation applied after the joint motion, always present for fixed steps
+            RigidTransform transform;
+            bool hasTransform{false};
+        };
+
+        FKPlan() = default;
+
+        static FKPlan compile(const std::vector<std::unique_ptr<KineComponent>>& components) {
+
+            FKPlan plan;
+            plan.steps_.reserve(components.size());
+            for (const auto& c : components) {
+
+                plan.jointsBefore_.emplace_back(plan.numDof_);
+
+                Step step;
+                if (const auto joint = dynamic_cast<const KineJoint*>(c.get())) {
+
+                    if (dynamic_cast<const RevoluteJoint*>(joint)) {
+                        step.type = StepType::Revolute;
+                    } else if (dynamic_cast<const PrismaticJoint*>(joint)) {
+                        step.type = StepType::Prismatic;
+                    } else {
+                        throw std::invalid_argument("Unsupported joint type");
+                    }
+
+                    plan.jointSteps_.emplace_back(plan.steps_.size());
+                    step.axis = joint->axis();
+                    step.principalAxis = joint->principalAxis();
+                    step.principalAxisSign = joint->principalAxisSign();
+                    step.lower = joint->limit().min().value_or(-std::numeric_limits<float>::max());
+                    step.upper = joint->limit().max().value_or(std::numeric_limits<float>::max());
+                    ++plan.numDof_;
+                } else {
+
+                    step.transform = c->getRigidTransformation();
+                    step.hasTransform = true;
+                }
+                plan.steps_.emplace_back(step);
+            }
+
+            return plan;
+        }
+
+        // Returns an equivalent plan where consecutive fixed steps are folded together and into the preceding joint,
+        // leaving one step per joint plus at most one leading fixed step.
+        // The frames of the optimized plan only correspond to the joints, not to every component.
+        [[nodiscard]] FKPlan optimized() const {
+
+            FKPlan plan;
+            plan.numDof_ = numDof_;
+            for (const auto& step : steps_) {
+
+                if (step.type == StepType::Fixed && !plan.steps_.empty()) {
+                    auto& prev = plan.steps_.back();
+                    if (prev.hasTransform) {
+                        prev.transform.multiply(step.transform);
+                    } else {
+                        prev.transform = step.transform;
+                        prev.hasTransform = true;
+                    }
+                    continue;
+                }
+
+                plan.jointsBefore_.emplace_back(plan.jointSteps_.size());
+                if (step.type != StepType::Fixed) {
+                    plan.jointSteps_.emplace_back(plan.steps_.size());
+                }
+                plan.steps_.emplace_back(step);
+            }
+
+            return plan;
+        }
+
+        [[nodiscard]] size_t numDof() const {
+            return numDof_;
+        }
+
+        [[nodiscard]] const std::vector<Step>& steps() const {
+            return steps_;
+        }
+
+        // Computes the end-effector transformation for the given joint values.
+        void evaluate(std::span<const float> values, bool normalized, RigidTransform& result) const {
+
+            checkNumValues(values.size());
+
+            result.identity();
+
+            const float* value = values.data();
+            for (const auto& step : steps_) {
+                apply(step, value, normalized, result);
+            }
+        }
+
+        void evaluate(std::span<const float> values, bool normalized, Matrix4& result) const {
+
+            RigidTransform tmp;
+            evaluate(values, normalized, tmp);
+            result = tmp.toMatrix4();
+        }
+
+        // Computes the transformation after every step in a single pass, frames[i] holds the product of steps 0..i.
+        void evaluateFrames(std::span<const float> values, bool normalized, std::span<RigidTransform> frames) const {
+
+            evaluateFrames(values, normalized, frames, [](const RigidTransform& t) { return t; });
+        }
+
+        void evaluateFrames(std::span<const float> values, bool normalized, std::span<Matrix4> frames) const {
+
+            evaluateFrames(values, normalized, frames, [](const RigidTransform& t) { return t.toMatrix4(); });
+        }
+
+        // Recomputes frames[from..] as in evaluateFrames, assuming frames[0..from) are already up to date.
+        // Values are expected to be denormalized.
+        void updateFrames(std::span<const float> values, std::span<RigidTransform> frames, size_t from) const {
+
+            RigidTransform result;
+            if (from > 0) result = frames[from - 1];
+
+            const float* value = values.data() + jointsBefore_[from];
+            for (size_t i = from; i < steps_.size(); ++i) {
+                apply(steps_[i], value, false, result);
+                frames[i] = result;
+            }
+        }
+
+        // Computes the 3 x numDof() positional Jacobian in column-major order, i.e. column j holds the end-effector
+        // velocity per unit of joint j (per degree for revolute joints, with respect to the denormalized value).
+        void evaluateJacobian(std::span<const float> values, bool normalized, std::span<float> jacobian) const {
+
+            evaluateJacobian(values, normalized, jacobian, false);
+        }
+
+        // Computes the 6 x numDof() Jacobian in column-major order, each column holding the linear velocity
+        // followed by the angular velocity (radians) of the end-effector per unit of joint j.
+        void evaluatePoseJacobian(std::span<const float> values, bool normalized, std::span<float> jacobian) const {
+
+            evaluateJacobian(values, normalized, jacobian, true);
+        }
+
+        // Post-multiplies result by the transformation of step, consuming a joint value if it is a joint.
+        static void apply(const Step& step, const float*& value, bool normalized, RigidTransform& result) {
+            switch (step.type) {
+                case StepType::Fixed:
+                    break;
+                case StepType::Revolute: {
+                    const float angle = jointValue(step, *value++, normalized) * DEG2RAD;
+                    const float c = std::cos(angle), s = std::sin(angle);
+                    if (step.principalAxis >= 0) {
+                        result.rotatePrincipal(step.principalAxis, c, step.principalAxisSign * s);
+                    } else {
+                        result.rotateOnAxis(step.axis, c, s);
+                    }
+                    break;
+                }
+                case StepType::Prismatic: {
+                    const float d = jointValue(step, *value++, normalized);
+                    if (step.principalAxis >= 0) {
+                        result.translatePrincipal(step.principalAxis, step.principalAxisSign * d);
+                    } else {
+                        result.translate(step.axis.x * d, step.axis.y * d, step.axis.z * d);
+                    }
+                    break;
+                }
+            }
+            if (step.hasTransform) {
+                result.multiply(step.transform);
+            }
+        }
+
+        // Index of the step belonging to the given joint.
+        [[nodiscard]] size_t jointStep(size_t joint) const {
+            return jointSteps_[joint];
+        }
+
+        // Computes the end-effector transformations for result.size() joint configurations at once.
+        // Values are laid out as structure-of-arrays, i.e. values[j * result.size() + i] holds joint j of configuration i.
+        // Configurations are processed in SIMD lane groups of 8.
+        void evaluateBatch(std::span<const float> values, std::span<Matrix4> result, bool normalized, SinCosAccuracy accuracy = SinCosAccuracy::Precise) const;
+
+        // Computes the sine and cosine of every joint angle for values.size() / numDof() configurations in the
+        // structure-of-arrays layout of evaluateBatch, i.e. the rotation block of each joint. Prismatic joints yield sin = 0 and cos = 1.
+        void evaluateRotations(std::span<const float> values, std::span<float> sines, std::span<float> cosines, bool normalized, SinCosAccuracy accuracy = SinCosAccuracy::Precise) const;
+
+    private:
+        size_t numDof_{};
+        std::vector<Step> steps_;
+        // step index of each joint
+        std::vector<size_t> jointSteps_;
+        // number of joints preceding each step
+        std::vector<size_t> jointsBefore_;
+
+        // One evaluation yields the end-effector position, a second sweep reads each joint's world axis a and origin p
+        // from the running frame and writes a x (e - p) (and a) for revolute and a (and 0) for prismatic joints.
+        void evaluateJacobian(std::span<const float> values, bool normalized, std::span<float> jacobian, bool angular) const {
+
+            const size_t rows = angular ? 6 : 3;
+            checkNumValues(values.size());
+            if (jacobian.size() < rows * numDof_) {
+                throw std::out_of_range("Expected room for " + std::to_string(rows * numDof_) + " Jacobian entries, got " + std::to_string(jacobian.size()));
+            }
+
+            RigidTransform result;
+            evaluate(values, normalized, result);
+            const auto& ee = result.elements;
+            const float ex = ee[9], ey = ee[10], ez = ee[11];
+
+            result.identity();
+            const auto& te = result.elements;
+            const float* value = values.data();
+            float* col = jacobian.data();
+            for (const auto& step : steps_) {
+
+                if (step.type != StepType::Fixed) {
+                    float a[3];
+                    if (step.principalAxis >= 0) {
+                        for (int k = 0; k < 3; ++k) a[k] = step.principalAxisSign * te[step.principalAxis * 3 + k];
+                    } else {
+                        const Vector3& axis = step.axis;
+                        for (int k = 0; k < 3; ++k) a[k] = te[k] * axis.x + te[3 + k] * axis.y + te[6 + k] * axis.z;
+                    }
+
+                    if (step.type == StepType::Revolute) {
+                        const float dx = ex - te[9], dy = ey - te[10], dz = ez - te[11];
+                        col[0] = (a[1] * dz - a[2] * dy) * DEG2RAD;
+                        col[1] = (a[2] * dx - a[0] * dz) * DEG2RAD;
+                        col[2] = (a[0] * dy - a[1] * dx) * DEG2RAD;
+                        if (angular) {
+                            for (int k = 0; k < 3; ++k) col[3 + k] = a[k] * DEG2RAD;
+                        }
+                    } else {
+                        for (int k = 0; k < 3; ++k) col[k] = a[k];
+                        if (angular) {
+                            for (int k = 0; k < 3; ++k) col[3 + k] = 0;
+                        }
+                    }
+                    col += rows;
+                }
+
+                apply(step, value, normalized, result);
+            }
+        }
+
+        template<class Frame, class Convert>
+        void evaluateFrames(std::span<const float> values, bool normalized, std::span<Frame> frames, Convert convert) const {
+
+            checkNumValues(values.size());
+            if (frames.size() < steps_.size()) {
+                throw std::out_of_range("Expected room for " + std::to_string(steps_.size()) + " frames, got " + std::to_string(frames.size()));
+            }
+
+            RigidTransform result;
+            const float* value = values.data();
+            for (unsigned i = 0; i < steps_.size(); ++i) {
+                apply(steps_[i], value, normalized, result);
+                frames[i] = convert(result);
+            }
+        }
+
+        void checkNumValues(size_t numValues) const {
+            if (numValues < numDof_) {
+                throw std::out_of_range("Expected " + std::to_string(numDof_) + " joint values, got " + std::to_string(numValues));
+            }
+        }
+
+        // Same mapping as KineLimit::denormalize, inlined
+        static float jointValue(const Step& step, float value, bool normalized) {
+            if (!normalized) return value;
+            return step.lower + std::clamp(value, 0.f, 1.f) * (step.upper - step.lower);
+        }
+    };
+
+}// namespace kine
+
+#endif//KINE_FKPLAN_HPP
@@ -2,8 +2,10 @@
 #ifndef KINE_KINE_HPP
 #define KINE_KINE_HPP
 
+#include <span>
 #include <vector>
 
+#include "FKPlan.hpp"
 #include "KineComponent.hpp"
 #include "KineLink.hpp"
 
@@ -13,16 +15,22 @@
 
 namespace kine {
 
+    // The immutable model of a kinematic chain. All member functions are const and free of
+    // internal caches, so a single instance can be shared between any number of threads without locking.
+    // Mutable per-query data, such as joint values and cached frames, lives in KineState (one per thread).
     class Kine {
 
     public:
         explicit Kine(std::vector<std::unique_ptr<KineComponent>> components)
-            : components_(std::move(components)) {
+            : components_(std::move(components)),
+              unoptimizedPlan_(FKPlan::compile(components_)),
+              plan_(unoptimizedPlan_.optimized()) {
 
             for (const auto& c : components_) {
 
-                if (const auto joint = dynamic_cast<KineJoint*>(c.get())) {
+                if (const auto joint = dynamic_cast<const KineJoint*>(c.get())) {
                     joints_.emplace_back(joint);
+                    limits_.emplace_back(joint->limit());
                 }
             }
         }
@@ -35,86 +43,113 @@ namespace kine {
         [[nodiscard]] Matrix4 calculateEndEffectorTransformation(const std::vector<float>& values, bool normalized = false) const {
 
             Matrix4 result;
-            for (unsigned i = 0, j = 0; i < components_.size(); ++i) {
-                const auto& c = components_[i];
-                if (const auto joint = dynamic_cast<KineJoint*>(c.get())) {
-                    auto value = values.at(j++);
-                    if (normalized) {
-                        value = joint->limit().denormalize(value);
-                    }
-                    result.multiply(joint->getTransformation(value));
-                } else {
-
-                    result.multiply(c->getTransformation());
-                }
-            }
+            plan_.evaluate(values, normalized, result);
             return result;
         }
 
-        [[nodiscard]] const std::vector<KineJoint*>& joints() const {
+        // Number of frames written by calculateFrames, one per component.
+        [[nodiscard]] size_t numFrames() const {
+            return components_.size();
+        }
+
+        // Computes the world transformation of every joint and link frame in a single pass.
+        // frames[i] holds the transformation after component i, so the last frame equals the end-effector transformation.
+        void calculateFrames(std::span<const float> values, std::span<Matrix4> frames, bool normalized = false) const {
+
+            unoptimizedPlan_.evaluateFrames(values, normalized, frames);
+        }
+
+        // Computes the end-effector transformation for result.size() joint configurations.
+        // Values are laid out as structure-of-arrays, i.e. values[j * result.size() + i] holds joint j of configuration i.
+        void calculateEndEffectorTransformations(std::span<const float> values, std::span<Matrix4> result, bool normalized = false, SinCosAccuracy accuracy = SinCosAccuracy::Precise) const {
+
+            plan_.evaluateBatch(values, result, normalized, accuracy);
+        }
+
+        // Computes the sine and cosine of every joint angle for values.size() / numDof() configurations,
+        // using the layout of calculateEndEffectorTransformations for both input and output.
+        void calculateJointRotations(std::span<const float> values, std::span<float> sines, std::span<float> cosines, bool normalized = false, SinCosAccuracy accuracy = SinCosAccuracy::Precise) const {
+
+            plan_.evaluateRotations(values, sines, cosines, normalized, accuracy);
+        }
+
+        // The plan used for evaluation, with constant links fused into the joints.
+        [[nodiscard]] const FKPlan& plan() const {
+            return plan_;
+        }
+
+        // The plan as compiled from the components, one step per component.
+        [[nodiscard]] const FKPlan& unoptimizedPlan() const {
+            return unoptimizedPlan_;
+        }
+
+        [[nodiscard]] const std::vector<const KineJoint*>& joints() const {
             return joints_;
         }
 
-        [[nodiscard]] std::vector<KineLimit> limits() const {
-            std::vector<KineLimit> limits;
-            for (unsigned i = 0; i < numDof(); i++) {
-                limits.emplace_back(joints_[i]->limit());
-            }
-            return limits;
+        [[nodiscard]] const std::vector<KineLimit>& limits() const {
+            return limits_;
         }
 
         [[nodiscard]] std::vector<float> meanAngles() const {
-            const auto lim = limits();
             std::vector<float> res(numDof());
-            for (unsigned i = 0; i < numDof(); ++i) {
-                res[i] = lim[i].mean();
-            }
+            meanAngles(res);
             return res;
         }
 
+        // Writes the mean of every joint's limits into values, which must hold numDof() values.
+        void meanAngles(std::span<float> values) const {
+            for (size_t i = 0; i < numDof(); ++i) {
+                values[i] = limits_[i].mean();
+            }
+        }
+
         [[nodiscard]] std::vector<float> normalizeValues(const std::vector<float>& values) const {
             std::vector<float> res(numDof());
-            for (unsigned i = 0; i < numDof(); ++i) {
-                res[i] = joints_[i]->limit().normalize(values[i]);
-            }
+            normalizeValues(values, res);
             return res;
         }
 
+        // Maps values into [0, 1] within the joint limits, result may be the same memory as values.
+        void normalizeValues(std::span<const float> values, std::span<float> result) const {
+            for (size_t i = 0; i < numDof(); ++i) {
+                result[i] = limits_[i].normalize(values[i]);
+            }
+        }
+
         [[nodiscard]] std::vector<float> denormalizeValues(const std::vector<float>& values) const {
             std::vector<float> res(numDof());
-            for (unsigned i = 0; i < numDof(); ++i) {
-                res[i] = joints_[i]->limit().denormalize(values[i]);
-            }
+            denormalizeValues(values, res);
             return res;
         }
 
-        // [[nodiscard]] std::vector<std::vector<float>> computeJacobian(const std::vector<float>& values) const {
-        //
-        //     constexpr float h = 0.0001;// some low value
-        //
-        //     std::vector<std::vector<float>> jacobian(3);
-        //     for (auto & row : jacobian)
-        //     {
-        //         row = std::vector<float>(numDof());
-        //     }
-        //     auto d1 = calculateEndEffectorTransformation(values);
-        //
-        //     for (int i = 0; i < 3; ++i) {
-        //         auto vals = values;// copy
-        //         vals[i] += h;
-        //         auto d2 = calculateEndEffectorTransformation(vals);
-        //
-        //         jacobian[0][i] = (d2[12] - d1[12]) / h;
-        //         jacobian[1][i] = (d2[13] - d1[13]) / h;
-        //         jacobian[2][i] = (d2[14] - d1[14]) / h;
-        //     }
-        //
-        //     return jacobian;
-        // }
+        // Inverse of normalizeValues, result may be the same memory as values.
+        void denormalizeValues(std::span<const float> values, std::span<float> result) const {
+            for (size_t i = 0; i < numDof(); ++i) {
+                result[i] = limits_[i].denormalize(values[i]);
+            }
+        }
+
+        // Computes the 3 x numDof() positional Jacobian in column-major order into jacobian,
+        // see FKPlan::evaluateJacobian. Revolute columns are per degree.
+        void computeJacobian(std::span<const float> values, std::span<float> jacobian, bool normalized = false) const {
+
+            plan_.evaluateJacobian(values, normalized, jacobian);
+        }
+
+        // Computes the 6 x numDof() Jacobian in column-major order into jacobian, each column holding the linear
+        // followed by the angular velocity (radians) per unit of the joint, see FKPlan::evaluatePoseJacobian.
+        void computePoseJacobian(std::span<const float> values, std::span<float> jacobian, bool normalized = false) const {
+
+            plan_.evaluatePoseJacobian(values, normalized, jacobian);
+        }
 
     private:
-        std::vector<KineJoint*> joints_;
+        std::vector<const KineJoint*> joints_;
+        std::vector<KineLimit> limits_;
         std::vector<std::unique_ptr<KineComponent>> components_;
+        FKPlan unoptimizedPlan_;
+        FKPlan plan_;
     };
 
     class KineBuilder {
@@ -3,6 +3,7 @@
 #define KINE_KINECOMPONENT_HPP
 
 #include "kine/math/Matrix4.hpp"
+#include "kine/math/RigidTransform.hpp"
 
 namespace kine {
 
@@ -11,6 +12,10 @@ namespace kine {
     public:
         [[nodiscard]] virtual Matrix4 getTransformation() const = 0;
 
+        [[nodiscard]] virtual RigidTransform getRigidTransformation() const {
+            return RigidTransform().setFromMatrix4(getTransformation());
+        }
+
         virtual ~KineComponent() = default;
     };
 
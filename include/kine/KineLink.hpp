@@ -10,14 +10,18 @@ namespace kine {
 
     public:
         KineLink(const Vector3& link)
-            : transformation_(Matrix4().setPosition(link)) {}
+            : transformation_(RigidTransform().setPosition(link)) {}
 
         [[nodiscard]] Matrix4 getTransformation() const override {
+            return transformation_.toMatrix4();
+        }
+
+        [[nodiscard]] RigidTransform getRigidTransformation() const override {
             return transformation_;
         }
 
     private:
-        Matrix4 transformation_;
+        RigidTransform transformation_;
     };
 
 }// namespace kine
@@ -0,0 +1,99 @@
+
+#ifndef KINE_KINESTATE_HPP
+#define KINE_KINESTATE_HPP
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "kine/Kine.hpp"
+
+namespace kine {
+
+    // Joint values of a Kine together with the cached transformation after each step of its plan.
+    // Changing a joint only invalidates the cached frames from that joint onward,
+    // which are recomputed lazily once a transformation is queried.
+    // The referenced Kine must outlive this object. A KineState is not synchronized,
+    // use one per thread and share the Kine between them.
+    class KineState {
+
+    public:
+        explicit KineState(const Kine& kine)
+            : kine_(&kine),
+              values_(kine.numDof()),
+              frames_(kine.plan().steps().size()) {}
+
+        KineState(const Kine& kine, std::span<const float> values)
+            : KineState(kine) {
+
+            setJointValues(values);
+        }
+
+        // Rebinds to kine and sets all joint values, reusing the storage held for the previous chain.
+        void reset(const Kine& kine, std::span<const float> values) {
+            kine_ = &kine;
+            values_.resize(kine.numDof());
+            frames_.resize(kine.plan().steps().size());
+            validFrames_ = 0;
+            setJointValues(values);
+        }
+
+        [[nodiscard]] const Kine& kine() const {
+            return *kine_;
+        }
+
+        [[nodiscard]] size_t numDof() const {
+            return values_.size();
+        }
+
+        [[nodiscard]] float getJointValue(size_t joint) const {
+            return values_[joint];
+        }
+
+        [[nodiscard]] const std::vector<float>& getJointValues() const {
+            return values_;
+        }
+
+        void setJointValue(size_t joint, float value) {
+            kine_->joints()[joint]->limit().clampWithinLimit(value);
+            if (value == values_[joint]) return;
+
+            values_[joint] = value;
+            validFrames_ = std::min(validFrames_, kine_->plan().jointStep(joint));
+        }
+
+        void setJointValues(std::span<const float> values) {
+            for (size_t i = 0; i < numDof(); ++i) {
+                setJointValue(i, values[i]);
+            }
+        }
+
+        // Transformation preceding the motion of the given joint, i.e. the frame its axis is expressed in.
+        [[nodiscard]] RigidTransform getJointFrame(size_t joint) {
+            update();
+            const size_t step = kine_->plan().jointStep(joint);
+            return step == 0 ? RigidTransform() : frames_[step - 1];
+        }
+
+        [[nodiscard]] const RigidTransform& getEndEffectorTransformation() {
+            update();
+            return frames_.back();
+        }
+
+    private:
+        const Kine* kine_;
+        std::vector<float> values_;
+        std::vector<RigidTransform> frames_;
+        size_t validFrames_{0};
+
+        void update() {
+            if (validFrames_ == frames_.size()) return;
+
+            kine_->plan().updateFrames(values_, frames_, validFrames_);
+            validFrames_ = frames_.size();
+        }
+    };
+
+}// namespace kine
+
+#endif//KINE_KINESTATE_HPP
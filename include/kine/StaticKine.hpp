@@ -0,0 +1,240 @@
+
+#ifndef KINE_STATICKINE_HPP
+#define KINE_STATICKINE_HPP
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+
+#include "kine/Kine.hpp"
+#include "kine/KineLimit.hpp"
+#include "kine/math/MathUtils.hpp"
+#include "kine/math/RigidTransform.hpp"
+
+namespace kine {
+
+    enum class Axis {
+        X,
+        Y,
+        Z
+    };
+
+    // Revolute joint rotating around a principal axis known at compile time.
+    template<Axis A>
+    struct Revolute {
+
+        static constexpr bool isJoint = true;
+        static constexpr bool isRevolute = true;
+        static constexpr int axisIndex = static_cast<int>(A);
+
+        KineLimit limit;
+
+        Revolute(const KineLimit& limit = {}): limit(limit) {}
+
+        void apply(float value, RigidTransform& t) const {
+            const float angle = value * DEG2RAD;
+            if constexpr (A == Axis::X) {
+                t.rotateX(angle);
+            } else if constexpr (A == Axis::Y) {
+                t.rotateY(angle);
+            } else {
+                t.rotateZ(angle);
+            }
+        }
+
+        void addTo(KineBuilder& builder) const {
+            builder.addRevoluteJoint({A == Axis::X ? 1.f : 0.f, A == Axis::Y ? 1.f : 0.f, A == Axis::Z ? 1.f : 0.f}, limit);
+        }
+    };
+
+    // Prismatic joint translating along a principal axis known at compile time.
+    template<Axis A>
+    struct Prismatic {
+
+        static constexpr bool isJoint = true;
+        static constexpr bool isRevolute = false;
+        static constexpr int axisIndex = static_cast<int>(A);
+
+        KineLimit limit;
+
+        Prismatic(const KineLimit& limit = {}): limit(limit) {}
+
+        void apply(float value, RigidTransform& t) const {
+            t.translate(A == Axis::X ? value : 0.f, A == Axis::Y ? value : 0.f, A == Axis::Z ? value : 0.f);
+        }
+
+        void addTo(KineBuilder& builder) const {
+            builder.addPrismaticJoint({A == Axis::X ? 1.f : 0.f, A == Axis::Y ? 1.f : 0.f, A == Axis::Z ? 1.f : 0.f}, limit);
+        }
+    };
+
+    // Constant translation between joints, set at runtime. See StaticLink for offsets known at compile time.
+    struct Link {
+
+        static constexpr bool isJoint = false;
+
+        float x, y, z;
+
+        Link(float x, float y, float z): x(x), y(y), z(z) {}
+
+        Link(const Vector3& link): x(link.x), y(link.y), z(link.z) {}
+
+        void apply(RigidTransform& t) const {
+            t.translate(x, y, z);
+        }
+
+        void addTo(KineBuilder& builder) const {
+            builder.addLink({x, y, z});
+        }
+    };
+
+    // Constant translation known at compile time, e.g. StaticLink<0.f, 4.2f, 0.f>.
+    // Zero components drop out of the unrolled FK entirely, the others are folded into it as constants.
+    template<float X, float Y, float Z>
+    struct StaticLink {
+
+        static constexpr bool isJoint = false;
+
+        void apply(RigidTransform& t) const {
+            auto& te = t.elements;
+            for (int k = 0; k < 3; ++k) {
+                float p = te[9 + k];
+                if constexpr (X != 0) p += te[k] * X;
+                if constexpr (Y != 0) p += te[3 + k] * Y;
+                if constexpr (Z != 0) p += te[6 + k] * Z;
+                te[9 + k] = p;
+            }
+        }
+
+        void addTo(KineBuilder& builder) const {
+            builder.addLink({X, Y, Z});
+        }
+    };
+
+    // A kinematic chain whose structure is fixed at compile time, e.g.
+    // StaticKine<Revolute<Axis::Y>, StaticLink<0.f, 4.2f, 0.f>, Revolute<Axis::X>, StaticLink<0.f, 0.f, 7.f>, ...>.
+    // Forward kinematics and the Jacobian are fully unrolled, and axis-aligned rotations only touch the affected columns.
+    // Use toKine() to obtain an equivalent Kine for use with the IKSolver implementations.
+    template<class... Components>
+    class StaticKine {
+
+    public:
+        static constexpr size_t DOF = (static_cast<size_t>(Components::isJoint) + ... + 0);
+
+        using Values = std::array<float, DOF>;
+
+        explicit StaticKine(Components... components)
+            : components_(std::move(components)...) {}
+
+        [[nodiscard]] constexpr size_t numDof() const {
+            return DOF;
+        }
+
+        void calculateEndEffectorTransformation(const Values& values, RigidTransform& result, bool normalized = false) const {
+
+            result.identity();
+
+            const float* value = values.data();
+            forEach([&](const auto& c) {
+                if constexpr (std::decay_t<decltype(c)>::isJoint) {
+                    const float v = *value++;
+                    c.apply(normalized ? c.limit.denormalize(v) : v, result);
+                } else {
+                    c.apply(result);
+                }
+            });
+        }
+
+        [[nodiscard]] Matrix4 calculateEndEffectorTransformation(const Values& values, bool normalized = false) const {
+
+            RigidTransform result;
+            calculateEndEffectorTransformation(values, result, normalized);
+            return result.toMatrix4();
+        }
+
+        // Computes the 3 x DOF positional Jacobian in column-major order, i.e. column j holds the
+        // end-effector velocity per unit of joint j (per degree for revolute joints, with respect to the denormalized value).
+        [[nodiscard]] std::array<float, 3 * DOF> computeJacobian(const Values& values, bool normalized = false) const {
+
+            std::array<float, 3 * DOF> positions{};
+            std::array<float, 3 * DOF> axes{};
+            std::array<bool, DOF> revolute{};
+
+            RigidTransform t;
+            size_t j = 0;
+            forEach([&](const auto& c) {
+                using C = std::decay_t<decltype(c)>;
+                if constexpr (C::isJoint) {
+                    // the joint axis in world coordinates is a column of the rotation preceding the joint
+                    for (int k = 0; k < 3; ++k) {
+                        positions[j * 3 + k] = t.elements[9 + k];
+                        axes[j * 3 + k] = t.elements[C::axisIndex * 3 + k];
+                    }
+                    revolute[j] = C::isRevolute;
+                    const float v = values[j++];
+                    c.apply(normalized ? c.limit.denormalize(v) : v, t);
+                } else {
+                    c.apply(t);
+                }
+            });
+
+            std::array<float, 3 * DOF> jacobian{};
+            for (size_t i = 0; i < DOF; ++i) {
+                const float* a = &axes[i * 3];
+                float* col = &jacobian[i * 3];
+                if (revolute[i]) {
+                    const float dx = t.elements[9] - positions[i * 3];
+                    const float dy = t.elements[10] - positions[i * 3 + 1];
+                    const float dz = t.elements[11] - positions[i * 3 + 2];
+                    col[0] = (a[1] * dz - a[2] * dy) * DEG2RAD;
+                    col[1] = (a[2] * dx - a[0] * dz) * DEG2RAD;
+                    col[2] = (a[0] * dy - a[1] * dx) * DEG2RAD;
+                } else {
+                    col[0] = a[0];
+                    col[1] = a[1];
+                    col[2] = a[2];
+                }
+            }
+
+            return jacobian;
+        }
+
+        [[nodiscard]] std::array<KineLimit, DOF> limits() const {
+            std::array<KineLimit, DOF> limits;
+            size_t j = 0;
+            forEach([&](const auto& c) {
+                if constexpr (std::decay_t<decltype(c)>::isJoint) {
+                    limits[j++] = c.limit;
+                }
+            });
+            return limits;
+        }
+
+        [[nodiscard]] Values meanAngles() const {
+            const auto lim = limits();
+            Values res;
+            for (size_t i = 0; i < DOF; ++i) {
+                res[i] = lim[i].mean();
+            }
+            return res;
+        }
+
+        // Builds an equivalent, dynamically dispatched Kine.
+        [[nodiscard]] Kine toKine() const {
+            KineBuilder builder;
+            forEach([&](const auto& c) { c.addTo(builder); });
+            return builder.build();
+        }
+
+    private:
+        std::tuple<Components...> components_;
+
+        template<class F>
+        void forEach(F&& f) const {
+            std::apply([&](const auto&... c) { (f(c), ...); }, components_);
+        }
+    };
+
+}// namespace kine
+
+#endif//KINE_STATICKINE_HPP
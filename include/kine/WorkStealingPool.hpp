@@ -0,0 +1,72 @@
+
+#ifndef KINE_WORKSTEALINGPOOL_HPP
+#define KINE_WORKSTEALINGPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace kine {
+
+    // Fixed set of worker threads running index ranges in parallel.
+    // Each parallelFor hands every worker an equal share of the indices, workers that run out
+    // steal half of the remaining share of another, so uneven task costs still keep all of them busy.
+    // The calling thread takes part as worker 0, a pool of size 1 runs everything inline.
+    class WorkStealingPool {
+
+    public:
+        explicit WorkStealingPool(unsigned int numThreads = std::thread::hardware_concurrency());
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        ~WorkStealingPool();
+
+        // Number of workers, including the calling thread.
+        [[nodiscard]] size_t size() const {
+            return ranges_.size();
+        }
+
+        // Calls task(index, worker) for every index in [0, count) and blocks until all calls have returned.
+        // worker < size() identifies the thread running the call, tasks of the same worker never overlap.
+        // The first exception thrown by a task is rethrown once all workers have stopped, remaining indices are skipped.
+        // Calls from several threads are serialized.
+        void parallelFor(size_t count, const std::function<void(size_t, size_t)>& task);
+
+    private:
+        // Indices [begin, end) left to a worker, the owner takes from the front and thieves from the back.
+        struct alignas(64) Range {
+            std::mutex mutex;
+            size_t begin{};
+            size_t end{};
+        };
+
+        std::vector<std::unique_ptr<Range>> ranges_;
+        std::vector<std::thread> threads_;
+
+        std::mutex callMutex_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        const std::function<void(size_t, size_t)>* task_{nullptr};
+        size_t generation_{0};
+        size_t running_{0};
+        bool stop_{false};
+        std::exception_ptr error_;
+        std::atomic<bool> cancelled_{false};
+
+        void workerLoop(size_t worker);
+        void run(size_t worker);
+        bool next(size_t worker, size_t& index);
+        bool steal(size_t worker);
+    };
+
+}// namespace kine
+
+#endif//KINE_WORKSTEALINGPOOL_HPP
@@ -0,0 +1,266 @@
+
+#ifndef KINE_ANALYTICALSOLVER_HPP
+#define KINE_ANALYTICALSOLVER_HPP
+
+#include "kine/ik/IKSolver.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace kine {
+
+    // Closed-form solver for 3-DOF chains made of a revolute base followed by two revolute joints with parallel axes,
+    // such as Crane3R (yaw about Y, two pitch joints about X). The base axis only needs to be non-parallel to the others,
+    // and links may hold arbitrary offsets.
+    // There are up to four solution branches (base flip times elbow up/down), solveIK picks the one
+    // within the joint limits closest to the start values, without iterating.
+    class AnalyticalSolver: public IKSolver {
+
+    public:
+        using Solution = std::array<float, 3>;
+
+        using IKSolver::solveIK;
+
+        // Whether the chain has the structure this solver handles.
+        static bool supports(const Kine& kine) {
+            return analyze(kine).has_value();
+        }
+
+        std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIKDetailed(kine, target, startValues).values;
+        }
+
+        IKResult solveIKDetailed(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIntoVector(kine, target, startValues);
+        }
+
+        IKStats solveIK(const Kine& kine, const Vector3& target, std::span<const float> startValues, std::span<float> result) override {
+
+            beginSolve();
+
+            const auto arm = analyze(kine);
+            if (!arm) {
+                throw std::invalid_argument("AnalyticalSolver requires a revolute joint followed by two parallel revolute joints");
+            }
+
+            std::array<Solution, 4> candidates;
+            std::array<bool, 4> exact;
+            const size_t count = branches(*arm, target, startValues[0] * DEG2RAD, startValues[1] * DEG2RAD, candidates, exact);
+
+            const auto& joints = kine.joints();
+            const auto distance = [&](const Solution& s) {
+                float sum = 0;
+                for (size_t i = 0; i < 3; ++i) sum += (s[i] - startValues[i]) * (s[i] - startValues[i]);
+                return sum;
+            };
+
+            // closest branch reaching the target within the limits
+            std::optional<Solution> best;
+            for (size_t i = 0; i < count; ++i) {
+                if (withinLimits(kine, candidates[i]) && exact[i] && (!best || distance(candidates[i]) < distance(*best))) {
+                    best = candidates[i];
+                    converged_ = true;
+                }
+            }
+
+            RigidTransform t;
+            if (best) {
+                kine.plan().evaluate(*best, false, t);
+                ++fkEvaluations_;
+                residual_ = t.getPosition().distanceTo(target);
+            } else {
+                // none does, fall back to the clamped branch ending up closest to the target
+                float bestError = std::numeric_limits<float>::max();
+                for (size_t i = 0; i < count; ++i) {
+                    auto& s = candidates[i];
+                    for (size_t j = 0; j < 3; ++j) joints[j]->limit().clampWithinLimit(s[j]);
+                    kine.plan().evaluate(s, false, t);
+                    ++fkEvaluations_;
+                    const float error = t.getPosition().distanceTo(target);
+                    if (!best || error < bestError - eps_ || (error < bestError + eps_ && distance(s) < distance(*best))) {
+                        best = s;
+                        bestError = std::min(error, bestError);
+                        residual_ = error;
+                    }
+                }
+                converged_ = residual_ < eps_;
+            }
+
+            std::copy(best->begin(), best->end(), result.begin());
+            return endSolve();
+        }
+
+        // All solution branches (degrees) reaching target within the joint limits, empty if it is out of reach.
+        [[nodiscard]] static std::vector<Solution> solveAll(const Kine& kine, const Vector3& target) {
+
+            const auto arm = analyze(kine);
+            if (!arm) return {};
+
+            std::array<Solution, 4> candidates;
+            std::array<bool, 4> exact;
+            const size_t count = branches(*arm, target, 0, 0, candidates, exact);
+
+            std::vector<Solution> result;
+            for (size_t i = 0; i < count; ++i) {
+                if (withinLimits(kine, candidates[i]) && exact[i]) result.emplace_back(candidates[i]);
+            }
+            return result;
+        }
+
+    private:
+        // Geometry of the chain at zero joint values, in world coordinates.
+        struct Arm {
+            Vector3 basePivot;
+            Vector3 baseAxis;
+            Vector3 shoulderPivot;
+            // shared by both arm joints, elbowSign is -1 when the elbow axis points the other way
+            Vector3 armAxis;
+            float elbowSign{1};
+            Vector3 endEffector;
+            // upper arm and forearm projected onto the plane of the arm joints
+            Vector3 upperArm;
+            Vector3 forearm;
+            float upperLength{};
+            float foreLength{};
+            // angle of the forearm relative to the upper arm at zero elbow value
+            float elbowOffset{};
+        };
+
+        static std::optional<Arm> analyze(const Kine& kine) {
+
+            const auto& plan = kine.plan();
+            if (plan.numDof() != 3) return std::nullopt;
+
+            std::array<Vector3, 3> pivots, axes;
+            RigidTransform running;
+            const float zeros[3]{};
+            const float* value = zeros;
+            size_t joint = 0;
+            for (const auto& step : plan.steps()) {
+                if (step.type == FKPlan::StepType::Prismatic) return std::nullopt;
+                if (step.type == FKPlan::StepType::Revolute) {
+                    pivots[joint] = running.getPosition();
+                    axes[joint] = running.transformDirection(step.axis).normalize();
+                    ++joint;
+                }
+                FKPlan::apply(step, value, false, running);
+            }
+
+            const auto parallel = [](const Vector3& a, const Vector3& b) {
+                return Vector3().crossVectors(a, b).length() < tolerance;
+            };
+            if (!parallel(axes[1], axes[2]) || parallel(axes[0], axes[1])) return std::nullopt;
+
+            Arm arm;
+            arm.basePivot = pivots[0];
+            arm.baseAxis = axes[0];
+            arm.shoulderPivot = pivots[1];
+            arm.armAxis = axes[1];
+            arm.elbowSign = axes[1].dot(axes[2]) < 0 ? -1.f : 1.f;
+            arm.endEffector = running.getPosition();
+            arm.upperArm = project(pivots[2] - pivots[1], arm.armAxis);
+            arm.forearm = project(arm.endEffector - pivots[2], arm.armAxis);
+            arm.upperLength = arm.upperArm.length();
+            arm.foreLength = arm.forearm.length();
+            if (arm.upperLength < tolerance || arm.foreLength < tolerance) return std::nullopt;
+            arm.elbowOffset = signedAngle(arm.upperArm, arm.forearm, arm.armAxis);
+
+            return arm;
+        }
+
+        // Fills out with the branches (degrees) for target and returns their number. Branches that cannot reach the target
+        // are not exact, and stretch or fold the arm to end up as close as possible instead.
+        // The given start angles (radians) are used for the base and shoulder when the target lies on their axis.
+        static size_t branches(const Arm& arm, const Vector3& target, float startBase, float startShoulder,
+                               std::array<Solution, 4>& out, std::array<bool, 4>& exact) {
+
+            const Vector3& a = arm.baseAxis;
+            const Vector3& b = arm.armAxis;
+            const Vector3 v = target - arm.basePivot;
+
+            // the component of the end-effector along the arm axis is fixed by the base angle alone:
+            // (R_a(theta) b) . v = b . (endEffector - basePivot), i.e. A cos(theta) + B sin(theta) = C
+            const float ab = a.dot(b);
+            const float av = a.dot(v);
+            const float A = b.dot(v) - ab * av;
+            const float B = Vector3().crossVectors(a, b).dot(v);
+            const float C = b.dot(arm.endEffector - arm.basePivot) - ab * av;
+            const float R = std::hypot(A, B);
+
+            std::array<float, 2> baseAngles{startBase, startBase};
+            bool reachable = std::abs(C) <= R + tolerance;
+            if (R > 1e-6f) {
+                const float phi = std::atan2(B, A);
+                const float delta = std::acos(std::clamp(C / R, -1.f, 1.f));
+                baseAngles = {phi + delta, phi - delta};
+            }
+
+            // planar 2R in the arm plane, law of cosines for the elbow
+            const float l1 = arm.upperLength, l2 = arm.foreLength;
+            size_t count = 0;
+            for (const float base : baseAngles) {
+
+                // target rotated back by the base angle, Rodrigues
+                const float c = std::cos(base), s = -std::sin(base);
+                const Vector3 local = arm.basePivot + v * c + Vector3().crossVectors(a, v) * s + a * (av * (1 - c));
+                const Vector3 w = project(local - arm.shoulderPivot, b);
+                const float cosElbow = (w.lengthSq() - l1 * l1 - l2 * l2) / (2 * l1 * l2);
+                const float k = std::clamp(cosElbow, -1.f, 1.f);
+
+                for (const float elbowSign : {1.f, -1.f}) {
+                    const float elbow = elbowSign * std::acos(k) - arm.elbowOffset;
+                    const Vector3 reach = arm.upperArm + arm.forearm * std::cos(elbow) +
+                                          Vector3().crossVectors(b, arm.forearm) * std::sin(elbow);
+                    const float shoulder = w.lengthSq() < 1e-12f ? startShoulder : signedAngle(reach, w, b);
+
+                    exact[count] = reachable && std::abs(cosElbow - k) < tolerance;
+                    out[count++] = {normalizeAngle(base) * RAD2DEG,
+                                    normalizeAngle(shoulder) * RAD2DEG,
+                                    normalizeAngle(arm.elbowSign * elbow) * RAD2DEG};
+                }
+            }
+
+            return count;
+        }
+
+        // Wraps each value into its limits if an equivalent angle fits, returning whether all of them do.
+        static bool withinLimits(const Kine& kine, Solution& s) {
+            bool within = true;
+            for (size_t i = 0; i < 3; ++i) {
+                const auto& limit = kine.joints()[i]->limit();
+                s[i] = wrapWithinLimit(limit, s[i]);
+                float clamped = s[i];
+                within &= !limit.clampWithinLimit(clamped);
+            }
+            return within;
+        }
+
+        static constexpr float tolerance = 1e-4f;
+
+        static Vector3 project(const Vector3& v, const Vector3& axis) {
+            return v - axis * axis.dot(v);
+        }
+
+        // Angle (radians) rotating u onto v around axis.
+        static float signedAngle(const Vector3& u, const Vector3& v, const Vector3& axis) {
+            return std::atan2(axis.dot(Vector3().crossVectors(u, v)), u.dot(v));
+        }
+
+        // Maps angle (radians) within one turn of [-pi, pi] into it.
+        static float normalizeAngle(float angle) {
+            if (angle > PI) return angle - 2 * PI;
+            if (angle < -PI) return angle + 2 * PI;
+            return angle;
+        }
+    };
+
+}// namespace kine
+
+#endif//KINE_ANALYTICALSOLVER_HPP
@@ -0,0 +1,90 @@
+
+#ifndef KINE_BATCHIKSOLVER_HPP
+#define KINE_BATCHIKSOLVER_HPP
+
+#include "kine/WorkStealingPool.hpp"
+#include "kine/ik/IKSolver.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace kine {
+
+    enum class IKStatus: uint8_t {
+        // the end-effector ended up within the tolerance of the target
+        Converged,
+        // the solver returned, but the end-effector is farther away than the tolerance
+        NotConverged,
+        // the solver threw, the result holds the seed
+        Failed
+    };
+
+    // Solves IK for many targets in parallel on a WorkStealingPool.
+    // Every worker owns a solver created by the factory, so solvers keep their workspaces between targets
+    // and need not be thread safe. The Kine is shared read-only between the workers.
+    // Targets are solved through the span overload of IKSolver::solveIK, so with the built-in solvers
+    // solving a target performs no heap allocations once its worker has seen the chain.
+    class BatchIKSolver {
+
+    public:
+        using SolverFactory = std::function<std::unique_ptr<IKSolver>()>;
+
+        // tolerance is the end-effector distance below which a target counts as converged.
+        explicit BatchIKSolver(const SolverFactory& factory, unsigned int numThreads = std::thread::hardware_concurrency(), float tolerance = 0.001f)
+            : pool_(numThreads),
+              tolerance_(tolerance) {
+
+            for (size_t i = 0; i < pool_.size(); ++i) {
+                solvers_.emplace_back(factory());
+            }
+        }
+
+        [[nodiscard]] size_t numThreads() const {
+            return pool_.size();
+        }
+
+        // Solves for every target, writing the joint values of target i to results[i * numDof, (i + 1) * numDof)
+        // and its outcome to status[i]. seeds holds either one start configuration per target, laid out like results,
+        // or a single configuration shared by all targets. Values are denormalized.
+        void solve(const Kine& kine, std::span<const Vector3> targets, std::span<const float> seeds,
+                   std::span<float> results, std::span<IKStatus> status) {
+
+            const size_t numDof = kine.numDof();
+            const size_t count = targets.size();
+            const bool sharedSeed = seeds.size() == numDof;
+            if (!sharedSeed && seeds.size() != count * numDof) {
+                throw std::invalid_argument("Expected " + std::to_string(numDof) + " or " + std::to_string(count * numDof) + " seed values, got " + std::to_string(seeds.size()));
+            }
+            if (results.size() < count * numDof || status.size() < count) {
+                throw std::out_of_range("Output spans must hold " + std::to_string(count * numDof) + " values and " + std::to_string(count) + " statuses");
+            }
+
+            pool_.parallelFor(count, [&](size_t i, size_t w) {
+                auto& solver = *solvers_[w];
+                const auto seed = seeds.subspan(sharedSeed ? 0 : i * numDof, numDof);
+                const auto result = results.subspan(i * numDof, numDof);
+
+                try {
+                    const auto stats = solver.solveIK(kine, targets[i], seed, result);
+                    status[i] = stats.residual < tolerance_ ? IKStatus::Converged : IKStatus::NotConverged;
+                } catch (const std::exception&) {
+                    std::copy(seed.begin(), seed.end(), result.begin());
+                    status[i] = IKStatus::Failed;
+                }
+            });
+        }
+
+    private:
+        WorkStealingPool pool_;
+        std::vector<std::unique_ptr<IKSolver>> solvers_;
+        float tolerance_;
+    };
+
+}// namespace kine
+
+#endif//KINE_BATCHIKSOLVER_HPP
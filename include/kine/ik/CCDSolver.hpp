@@ -1,57 +1,87 @@
 #ifndef KINE_CCDSOLVER_HPP
 #define KINE_CCDSOLVER_HPP
 
+#include "kine/KineState.hpp"
 #include "kine/ik/IKSolver.hpp"
 
+#include <algorithm>
+#include <optional>
+
 namespace kine {
 
+    // Cyclic coordinate descent. Each joint in turn is set to the value that brings the end-effector
+    // closest to the target while the others are held fixed, computed in closed form from the joint frame:
+    // revolute joints rotate the end-effector towards the target within the plane orthogonal to their axis,
+    // prismatic joints move it by the target offset along their axis. The results are clamped to the joint limits.
     class CCDSolver: public IKSolver {
 
     public:
-        explicit CCDSolver(unsigned int maxTries = 10, float stepSize = 0.005f, float eps = 0.00001f)
-            : maxTries(maxTries),
-              stepSize(stepSize),
-              eps(eps) {}
+        // The tolerance defaults to 0.00001, see setEPS.
+        explicit CCDSolver(unsigned int maxTries = 100)
+            : maxTries(maxTries) {
+
+            setEPS(0.00001f);
+        }
+
+        using IKSolver::solveIK;
 
         std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
 
-            Vector3 endPos;
-            endPos.setFromMatrixPosition(kine.calculateEndEffectorTransformation(startValues));
+            return solveIKDetailed(kine, target, startValues).values;
+        }
+
+        IKResult solveIKDetailed(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIntoVector(kine, target, startValues);
+        }
+
+        IKStats solveIK(const Kine& kine, const Vector3& target, std::span<const float> startValues, std::span<float> result) override {
 
+            beginSolve();
+
+            // the frames before the joint being updated are cached and reused, the state is kept between solves
+            if (state_) {
+                state_->reset(kine, startValues);
+            } else {
+                state_.emplace(kine, startValues);
+            }
+            auto& state = *state_;
+
+            Vector3 endPos = state.getEndEffectorTransformation().getPosition();
+            ++fkEvaluations_;
             float error = endPos.distanceTo(target);
-            if (error < eps) return startValues;
 
-            unsigned int tries = 0;
-            std::vector<float> newValues = kine.normalizeValues(startValues);
-            while (true) {
+            const auto& plan = kine.plan();
+            for (unsigned int tries = 0; tries < maxTries && error >= eps_ && nextIteration(); ++tries) {
                 for (unsigned i = 0; i < kine.numDof(); ++i) {
-                    float closest = std::numeric_limits<float>::max();
-                    float k = 0;
-                    float val = 0;
-
-                    do {
-                        newValues[i] = k;
-                        endPos.setFromMatrixPosition(kine.calculateEndEffectorTransformation(kine.denormalizeValues(newValues)));
-
-                        error = endPos.distanceTo(target);
-                        if (error < closest) {
-                            closest = error;
-                            val = k;
-                        }
-                    } while ((k += stepSize) <= 1);
-
-                    newValues[i] = val;
+
+                    const auto frame = state.getJointFrame(i);
+                    const auto& step = plan.steps()[plan.jointStep(i)];
+                    const Vector3 axis = frame.transformDirection(step.axis).normalize();
+
+                    const float value = state.getJointValue(i);
+                    if (step.type == FKPlan::StepType::Revolute) {
+                        state.setJointValue(i, optimalAngle(kine.joints()[i]->limit(), value, axis, frame.getPosition(), endPos, target));
+                    } else {
+                        // FK moves the joint by value * axis, which need not be a unit vector
+                        state.setJointValue(i, value + axis.dot(target - endPos) / step.axis.length());
+                    }
+                    endPos = state.getEndEffectorTransformation().getPosition();
+                    ++fkEvaluations_;
                 }
-                if (++tries >= maxTries || error < eps) break;
+                error = endPos.distanceTo(target);
             }
 
-            return kine.denormalizeValues(newValues);
+            // every joint update brings the end-effector closer, the current values are the best so far
+            residual_ = error;
+            converged_ = error < eps_;
+            std::copy(state.getJointValues().begin(), state.getJointValues().end(), result.begin());
+            return endSolve();
         }
 
     private:
         unsigned int maxTries;
-        float stepSize;
-        float eps;
+        std::optional<KineState> state_;
     };
 
 }// namespace kine
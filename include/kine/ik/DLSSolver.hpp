@@ -2,85 +2,138 @@
 #ifndef KINE_DLSSOLVER_HPP
 #define KINE_DLSSOLVER_HPP
 
-#include "kine/ik/IKSolver.hpp"
+#include "kine/ik/JacobianSolver.hpp"
 
 #include "Eigen/Dense"
 
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+
 namespace kine {
 
-    class DLSSolver: public IKSolver {
+    // Damped least squares solver. All per-iteration storage is fixed-size or kept in the solver,
+    // so once it has seen a chain of a given size, solving into a span performs no heap allocations.
+    // Dof fixes the number of joints at compile time, leaving every matrix on the stack.
+    template<int Dof = Eigen::Dynamic>
+    class BasicDLSSolver: public JacobianSolver<BasicDLSSolver<Dof>> {
 
     public:
-        explicit DLSSolver(double lambda = 0.5)
+        explicit BasicDLSSolver(double lambda = 0.5)
             : lambdaSq_(lambda * lambda) {}
 
-        std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
-
-            auto vals = startValues;
-
-            threepp::Vector3 vec;
-            Eigen::MatrixX<double> mat;
-            for (int i = 0; i < 100; ++i) {
-
-                auto j = computeJacobian(kine, vals);
+    private:
+        template<int Rows>
+        struct Workspace {
+            Eigen::Matrix<float, Rows, Dof> jacobian;
+            Eigen::Matrix<double, Rows, Dof> weighted;
+            Eigen::Vector<double, Dof> scale;
+            Eigen::Vector<double, Dof> step;
+            Eigen::Vector<float, Dof> best;
+            Eigen::Vector<double, Rows> error;
+            Eigen::Vector<double, Rows> solution;
+            Eigen::LDLT<Eigen::Matrix<double, Rows, Rows>> ldlt;
+        };
 
-                auto m = kine.calculateEndEffectorTransformation(vals);
-                auto& actual = vec.setFromMatrixPosition(m.elements);
+        double lambdaSq_;
+        Workspace<3> workspace3_;
+        Workspace<6> workspace6_;
 
-                const float error = actual.distanceTo(target);
-                if (error < this->eps_) break;
+        friend class JacobianSolver<BasicDLSSolver>;
 
-                Eigen::Vector3<double> delta{target.x - actual.x, target.y - actual.y, target.z - actual.z};
+        template<int Rows, class ErrorFunction>
+        void iterate(const Kine& kine, std::span<float> values, const Eigen::Vector<double, Rows>& weights, ErrorFunction computeError) {
 
-                auto inv = DLS(j);
-                auto theta_dot = inv * delta;
+            auto& ws = workspace<Rows>();
 
-                for (int k = 0; k < kine.numDof(); ++k) {
+            const auto numDof = static_cast<Eigen::Index>(kine.numDof());
+            if (Dof != Eigen::Dynamic && numDof != Dof) {
+                throw std::invalid_argument("Solver expects " + std::to_string(Dof) + " joints, got " + std::to_string(numDof));
+            }
+            if (ws.jacobian.cols() != numDof) {
+                ws.jacobian.resize(Rows, numDof);
+                ws.weighted.resize(Rows, numDof);
+                ws.scale.resize(numDof);
+                ws.step.resize(numDof);
+                ws.best.resize(numDof);
+            }
 
-                    vals[k] += static_cast<float>(theta_dot[k]);
-                    const KineLimit& lim = kine.joints()[k]->limit();
-                    lim.clampWithinLimit(vals[k]);
-                }
+            // damp revolute steps in radians, against the per-degree Jacobian lambda would dominate and stall the solver
+            const auto& plan = kine.plan();
+            for (Eigen::Index k = 0; k < numDof; ++k) {
+                ws.scale[k] = this->jacobianScale(kine, k);
             }
 
-            return vals;
-        }
+            const auto& joints = kine.joints();
+            const std::span<float> jacobian(ws.jacobian.data(), static_cast<size_t>(ws.jacobian.size()));
 
-    private:
-        double lambdaSq_;
+            this->beginSolve();
+            double bestNorm = std::numeric_limits<double>::infinity();
+            bool atBest = false;
 
-        Eigen::MatrixX<double> DLS(const Eigen::MatrixX<double>& j) {
+            RigidTransform t;
+            for (int i = 0;; ++i) {
 
-            Eigen::MatrixX<double> I(j.rows(), j.rows());
-            I.setIdentity();
+                plan.evaluate(values, false, t);
+                ++this->fkEvaluations_;
+                computeError(t, ws.error);
 
-            auto jt = j.transpose();
-            auto jjt = j * jt;
-            auto plus = I * lambdaSq_;
+                // a step may increase the error, keep the best values for when the iterations or the budget run out
+                const double norm = weights.cwiseProduct(ws.error).norm();
+                atBest = norm < bestNorm;
+                if (atBest) {
+                    bestNorm = norm;
+                    std::copy(values.begin(), values.end(), ws.best.data());
+                    this->setResiduals(ws.error);
+                }
+                ws.error = weights.cwiseProduct(ws.error);
+                if (norm < this->eps_) {
+                    this->converged_ = true;
+                    break;
+                }
+                if (i == maxIterations || !this->nextIteration()) break;
 
-            return jt * ((jjt + plus).inverse());
-        }
+                if constexpr (Rows == 6) {
+                    kine.computePoseJacobian(values, jacobian);
+                } else {
+                    kine.computeJacobian(values, jacobian);
+                }
+                ++this->jacobianEvaluations_;
+                ws.weighted.noalias() = weights.asDiagonal() * ws.jacobian.template cast<double>() * ws.scale.asDiagonal();
 
-        [[nodiscard]] Eigen::MatrixX<double> computeJacobian(const Kine& kine, const std::vector<float>& values) const {
+                // theta = J^T (J J^T + lambda^2 I)^-1 e, solving the small Rows x Rows system instead of inverting it
+                Eigen::Matrix<double, Rows, Rows> jjt = ws.weighted.lazyProduct(ws.weighted.transpose());
+                jjt.diagonal().array() += lambdaSq_;
+                ws.ldlt.compute(jjt);
+                ws.solution = ws.ldlt.solve(ws.error);
+                ws.step.noalias() = ws.weighted.transpose().lazyProduct(ws.solution);
 
-            constexpr double h = 0.0001;// some low value
+                for (Eigen::Index k = 0; k < numDof; ++k) {
 
-            Eigen::MatrixX<double> jacobian(3, kine.numDof());
-            auto d1 = kine.calculateEndEffectorTransformation(values);
+                    values[k] += static_cast<float>(ws.scale[k] * ws.step[k]);
+                    joints[k]->limit().clampWithinLimit(values[k]);
+                }
+            }
 
-            for (int i = 0; i < 3; ++i) {
-                auto vals = values;// copy
-                vals[i] += h;
-                auto d2 = kine.calculateEndEffectorTransformation(vals);
+            if (!atBest) std::copy_n(ws.best.data(), numDof, values.begin());
+        }
 
-                jacobian(0, i) = (d2[12] - d1[12]) / h;
-                jacobian(1, i) = (d2[13] - d1[13]) / h;
-                jacobian(2, i) = (d2[14] - d1[14]) / h;
+        template<int Rows>
+        Workspace<Rows>& workspace() {
+            if constexpr (Rows == 6) {
+                return workspace6_;
+            } else {
+                return workspace3_;
             }
-            return jacobian;
         }
+
+        static constexpr int maxIterations = 100;
     };
 
+    using DLSSolver = BasicDLSSolver<>;
+
 }// namespace kine
 
 #endif//KINE_DLSSOLVER_HPP
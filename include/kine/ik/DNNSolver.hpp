@@ -7,6 +7,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <span>
 
 namespace kine {
 
@@ -14,10 +15,21 @@ class DNNSolver : public IKSolver {
 
 public:
 
-    DNNSolver(const std::filesystem::path& model);
+    // maxBatchSize bounds the rows of the tensors run by solveBatch, intraOpThreads is passed on to onnxruntime.
+    explicit DNNSolver(const std::filesystem::path& model, size_t maxBatchSize = 1024, int intraOpThreads = 1);
+
+    using IKSolver::solveIK;
 
     std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override;
 
+    IKResult solveIKDetailed(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override;
+
+    // Solves for every target, writing the joint values of target i to results[i * numDof, (i + 1) * numDof).
+    // Targets are packed into {n, 3} tensors of at most maxBatchSize rows, each solved by a single inference
+    // whose output is written straight into results. If residuals is not empty, residuals[i] receives the
+    // end-effector distance to target i. Models exported with a fixed batch size are run one target at a time.
+    void solveBatch(const Kine& kine, std::span<const Vector3> targets, std::span<float> results, std::span<float> residuals = {});
+
     ~DNNSolver() override;
 
 private:
@@ -0,0 +1,168 @@
+
+#ifndef KINE_FABRIKSOLVER_HPP
+#define KINE_FABRIKSOLVER_HPP
+
+#include "kine/ik/IKSolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace kine {
+
+    // Forward And Backward Reaching IK on the chain of joint pivots.
+    // Each iteration takes the pivot and end-effector positions from one FK pass, runs a backward (from the target)
+    // and forward (from the base) reaching pass over them, and back-projects the reached positions onto the joints:
+    // walking from the base, each joint takes the value (clamped to its limits) fitting all points downstream of it
+    // to their reached positions in the least squares sense, i.e. the rotation best aligning them for revolute joints
+    // and their mean offset along the axis for prismatic ones.
+    // The back-projection keeps the result a valid configuration of the chain, whatever its joint types and limits.
+    class FABRIKSolver: public IKSolver {
+
+    public:
+        explicit FABRIKSolver(unsigned int maxIterations = 100)
+            : maxIterations_(maxIterations) {}
+
+        using IKSolver::solveIK;
+
+        std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIKDetailed(kine, target, startValues).values;
+        }
+
+        IKResult solveIKDetailed(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIntoVector(kine, target, startValues);
+        }
+
+        IKStats solveIK(const Kine& kine, const Vector3& target, std::span<const float> startValues, std::span<float> result) override {
+
+            const auto& plan = kine.plan();
+            const auto& steps = plan.steps();
+            const size_t numDof = kine.numDof();
+
+            beginSolve();
+
+            values_.resize(numDof);
+            std::copy_n(startValues.begin(), numDof, values_.begin());
+            for (size_t i = 0; i < numDof; ++i) {
+                kine.joints()[i]->limit().clampWithinLimit(values_[i]);
+            }
+            best_ = values_;
+            float bestError = std::numeric_limits<float>::max();
+
+            frames_.resize(steps.size());
+            points_.resize(numDof + 1);
+            reached_.resize(numDof + 1);
+            lengths_.resize(numDof);
+
+            for (unsigned int iteration = 0;; ++iteration) {
+
+                // pivots of all joints followed by the end-effector, from one pass
+                plan.updateFrames(values_, frames_, 0);
+                ++fkEvaluations_;
+                for (size_t i = 0; i < numDof; ++i) {
+                    points_[i] = jointFrame(plan, i).getPosition();
+                }
+                points_[numDof] = frames_.back().getPosition();
+
+                // the back-projection may move the end-effector away, keep the best values so far
+                const float error = points_[numDof].distanceTo(target);
+                if (error < bestError) {
+                    bestError = error;
+                    best_ = values_;
+                }
+                if (error < eps_ || iteration == maxIterations_ || !nextIteration()) break;
+
+                for (size_t i = 0; i < numDof; ++i) {
+                    lengths_[i] = points_[i].distanceTo(points_[i + 1]);
+                }
+
+                // backward from the target, then forward from the fixed base
+                reached_ = points_;
+                reached_[numDof] = target;
+                for (size_t i = numDof; i-- > 0;) {
+                    reach(reached_[i], reached_[i + 1], lengths_[i]);
+                }
+                reached_[0] = points_[0];
+                for (size_t i = 0; i < numDof; ++i) {
+                    reach(reached_[i + 1], reached_[i], lengths_[i]);
+                }
+
+                // back-project, the running transformation precedes the current step
+                RigidTransform running;
+                const float* value = values_.data();
+                size_t joint = 0;
+                for (const auto& step : steps) {
+
+                    if (step.type != FKPlan::StepType::Fixed) {
+                        // the points after this joint moved rigidly with its frame as the joints before it changed
+                        const auto toWorld = RigidTransform().multiplyTransforms(running, jointFrame(plan, joint).invert());
+                        const Vector3 pivot = running.getPosition();
+                        const Vector3 axis = running.transformDirection(step.axis).normalize();
+
+                        float& v = values_[joint];
+                        const auto& limit = kine.joints()[joint]->limit();
+                        if (step.type == FKPlan::StepType::Revolute) {
+                            // rotation best aligning all downstream points with their reached positions in the least squares sense
+                            float sinSum = 0, cosSum = 0;
+                            for (size_t i = joint + 1; i <= numDof; ++i) {
+                                Vector3 u = toWorld.transformPoint(points_[i]) - pivot;
+                                Vector3 w = reached_[i] - pivot;
+                                u -= axis * axis.dot(u);
+                                w -= axis * axis.dot(w);
+                                sinSum += axis.dot(Vector3().crossVectors(u, w));
+                                cosSum += u.dot(w);
+                            }
+                            if (sinSum != 0 || cosSum != 0) {
+                                v = wrapWithinLimit(limit, v + std::atan2(sinSum, cosSum) * RAD2DEG);
+                            }
+                        } else {
+                            // all downstream points translate together, the mean offset along the axis
+                            float offset = 0;
+                            for (size_t i = joint + 1; i <= numDof; ++i) {
+                                offset += axis.dot(reached_[i] - toWorld.transformPoint(points_[i]));
+                            }
+                            v += offset / static_cast<float>(numDof - joint) / step.axis.length();
+                        }
+                        limit.clampWithinLimit(v);
+                        ++joint;
+                    }
+
+                    FKPlan::apply(step, value, false, running);
+                }
+            }
+
+            residual_ = bestError;
+            converged_ = bestError < eps_;
+            std::copy(best_.begin(), best_.end(), result.begin());
+            return endSolve();
+        }
+
+    private:
+        unsigned int maxIterations_;
+        std::vector<RigidTransform> frames_;
+        std::vector<Vector3> points_;
+        std::vector<Vector3> reached_;
+        std::vector<float> lengths_;
+        std::vector<float> values_;
+        std::vector<float> best_;
+
+        // Transformation preceding the motion of the given joint.
+        [[nodiscard]] RigidTransform jointFrame(const FKPlan& plan, size_t joint) const {
+            const size_t step = plan.jointStep(joint);
+            return step == 0 ? RigidTransform() : frames_[step - 1];
+        }
+
+        // Moves point onto the sphere of the given radius around anchor, towards its current position.
+        static void reach(Vector3& point, const Vector3& anchor, float length) {
+            const Vector3 offset = point - anchor;
+            const float distance = offset.length();
+            point = distance < 1e-12f ? anchor : anchor + offset * (length / distance);
+        }
+    };
+
+}// namespace kine
+
+#endif//KINE_FABRIKSOLVER_HPP
@@ -1,23 +1,234 @@
 #ifndef KINE_IKSOLVER_HPP
 #define KINE_IKSOLVER_HPP
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stop_token>
+#include <vector>
+
 #include "kine/Kine.hpp"
+#include "kine/math/Quaternion.hpp"
 
 namespace kine {
 
+    // Per-axis weights of the pose error, see the pose overload of IKSolver::solveIK.
+    // Orientation errors are measured as rotation vectors in radians, position errors in length units.
+    struct PoseWeights {
+        Vector3 position{1, 1, 1};
+        Vector3 orientation{1, 1, 1};
+    };
+
+    // Bounds the work of a single solve, zero meaning unbounded. Once either budget is spent,
+    // iterative solvers stop and return the best values found so far, see IKSolver::converged.
+    struct IKBudget {
+        std::chrono::microseconds time{0};
+        unsigned int iterations{0};
+    };
+
+    enum class IKTermination: uint8_t {
+        // the end-effector ended up within eps of the target
+        Converged,
+        // the solver ran out of its own iterations, stalled, or finished its single pass farther away than eps
+        NotConverged,
+        // the IKBudget was spent
+        BudgetExhausted,
+        // the stop token was triggered
+        Cancelled
+    };
+
+    // How a solve went, see IKSolver::solveIKDetailed.
+    struct IKStats {
+        IKTermination termination{IKTermination::NotConverged};
+        // end-effector distance to the target
+        float residual{};
+        unsigned int iterations{};
+        unsigned int fkEvaluations{};
+        unsigned int jacobianEvaluations{};
+        std::chrono::nanoseconds wallTime{};
+
+        [[nodiscard]] bool converged() const { return termination == IKTermination::Converged; }
+    };
+
+    // Joint values found by a solve, along with how it went.
+    struct IKResult: IKStats {
+        std::vector<float> values;
+    };
+
     class IKSolver {
 
     public:
         virtual std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) = 0;
 
+        // Solves like solveIK, additionally reporting the residual, the work done and why the solve ended.
+        // By default the residual is measured after solveIK returns and the solve counts as converged within eps,
+        // solvers not counting evaluations report zero for them.
+        virtual IKResult solveIKDetailed(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) {
+
+            beginSolve();
+            auto values = solveIK(kine, target, startValues);
+
+            RigidTransform t;
+            kine.plan().evaluate(values, false, t);
+            residual_ = t.getPosition().distanceTo(target);
+            converged_ = residual_ < eps_;
+
+            return {endSolve(), std::move(values)};
+        }
+
+        // Solves into result, which may be the same memory as startValues. The built-in solvers keep their workspace
+        // between calls, so once they have seen a chain of a given size this performs no heap allocations.
+        // By default it goes through solveIKDetailed.
+        virtual IKStats solveIK(const Kine& kine, const Vector3& target, std::span<const float> startValues, std::span<float> result) {
+
+            auto solution = solveIKDetailed(kine, target, {startValues.begin(), startValues.end()});
+            std::copy(solution.values.begin(), solution.values.end(), result.begin());
+            return solution;
+        }
+
+        // Solves for a full end-effector pose. Solvers without orientation support
+        // fall back to solving for the position only.
+        virtual std::vector<float> solveIK(const Kine& kine, const Vector3& position, const Quaternion& /*orientation*/,
+                                           const std::vector<float>& startValues, const PoseWeights& /*weights*/ = {}) {
+
+            return solveIK(kine, position, startValues);
+        }
+
         void setEPS(float eps) { eps_ = eps; }
 
+        // Lets another thread cancel solves, iterative solvers then return their current values early.
+        void setStopToken(std::stop_token token) { stopToken_ = std::move(token); }
+
+        void setBudget(const IKBudget& budget) { budget_ = budget; }
+
+        [[nodiscard]] const IKBudget& budget() const { return budget_; }
+
+        // Whether the last solve ended up within eps of the target.
+        [[nodiscard]] bool converged() const { return converged_; }
+
+        // End-effector distance to the target position after the last solve.
+        [[nodiscard]] float residual() const { return residual_; }
+
         virtual ~IKSolver() = default;
 
     protected:
+        using Clock = std::chrono::steady_clock;
+
         float eps_{0.001f};
+        std::stop_token stopToken_;
+        IKBudget budget_;
+        bool converged_{false};
+        Clock::time_point start_;
+        Clock::time_point deadline_{Clock::time_point::max()};
+        unsigned int iterations_{0};
+        unsigned int fkEvaluations_{0};
+        unsigned int jacobianEvaluations_{0};
+        float residual_{std::numeric_limits<float>::infinity()};
+        IKTermination termination_{IKTermination::NotConverged};
+
+        [[nodiscard]] bool stopRequested() const { return stopToken_.stop_requested(); }
+
+        // Starts the budget of a new solve, called by solvers on entry.
+        void beginSolve() {
+            converged_ = false;
+            iterations_ = 0;
+            fkEvaluations_ = 0;
+            jacobianEvaluations_ = 0;
+            residual_ = std::numeric_limits<float>::infinity();
+            termination_ = IKTermination::NotConverged;
+            start_ = Clock::now();
+            deadline_ = budget_.time.count() > 0 ? start_ + budget_.time : Clock::time_point::max();
+        }
+
+        // Whether another iteration may run, counting it. False once the solve is cancelled or its budget is spent.
+        bool nextIteration() {
+            if (stopRequested()) {
+                termination_ = IKTermination::Cancelled;
+                return false;
+            }
+            if ((budget_.iterations > 0 && iterations_ >= budget_.iterations) ||
+                (deadline_ != Clock::time_point::max() && Clock::now() >= deadline_)) {
+                termination_ = IKTermination::BudgetExhausted;
+                return false;
+            }
+            ++iterations_;
+            return true;
+        }
+
+        // Adds the work of a solve run by a wrapped solver to the current one, taking over why it ended.
+        void accumulate(const IKStats& inner) {
+            iterations_ += inner.iterations;
+            fkEvaluations_ += inner.fkEvaluations;
+            jacobianEvaluations_ += inner.jacobianEvaluations;
+            if (inner.termination != IKTermination::Converged) termination_ = inner.termination;
+        }
+
+        // Stats of the solve started by beginSolve, with the residual set by the solver.
+        [[nodiscard]] IKStats endSolve() const {
+            return {converged_ ? IKTermination::Converged : termination_, residual_,
+                    iterations_, fkEvaluations_, jacobianEvaluations_,
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_)};
+        }
+
+        // solveIKDetailed in terms of the span overload of solveIK, for solvers implementing that one.
+        IKResult solveIntoVector(const Kine& kine, const Vector3& target, std::span<const float> startValues) {
+            IKResult result;
+            result.values.resize(kine.numDof());
+            static_cast<IKStats&>(result) = solveIK(kine, target, startValues, result.values);
+            return result;
+        }
+
+        // Factor converting the Jacobian column of the given joint from per degree to per radian, 1 for prismatic joints.
+        // Damping and step sizes are better conditioned when revolute joints are solved for in radians.
+        static double jacobianScale(const Kine& kine, size_t joint) {
+            const auto& plan = kine.plan();
+            return plan.steps()[plan.jointStep(joint)].type == FKPlan::StepType::Revolute ? RAD2DEG : 1;
+        }
+
+        // Angle (degrees) of the joint rotating around axis through pivot that takes the end-effector closest to target.
+        static float optimalAngle(const KineLimit& limit, float value, const Vector3& axis, const Vector3& pivot, const Vector3& endPos, const Vector3& target) {
+
+            // project both onto the plane of rotation
+            Vector3 u = endPos - pivot;
+            Vector3 v = target - pivot;
+            u -= axis * axis.dot(u);
+            v -= axis * axis.dot(v);
+
+            // degenerate, the end-effector or the target lies on the axis
+            if (u.lengthSq() < 1e-12f || v.lengthSq() < 1e-12f) return value;
+
+            const float delta = std::atan2(axis.dot(Vector3().crossVectors(u, v)), u.dot(v)) * RAD2DEG;
+            return wrapWithinLimit(limit, value + delta);
+        }
+
+        // An angle (degrees) equivalent to angle within the limits, e.g. angle - 360, or angle itself if there is none.
+        static float wrapWithinLimit(const KineLimit& limit, float angle) {
+            for (const float candidate : {angle, angle - 360, angle + 360}) {
+                float clamped = candidate;
+                if (!limit.clampWithinLimit(clamped)) return candidate;
+            }
+            return angle;
+        }
+
+        // Rotation vector (axis * angle in radians) taking actual to target, expressed in world coordinates.
+        static Vector3 orientationError(const Quaternion& target, const Quaternion& actual) {
+
+            // target * actual^-1, taking the shortest way around
+            Quaternion q = actual;
+            q.invert().premultiply(target);
+            if (q.w < 0) q.set(-q.x, -q.y, -q.z, -q.w);
+
+            const float sinHalf = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+            if (sinHalf < 1e-7f) return {2 * q.x, 2 * q.y, 2 * q.z};
+
+            const float scale = 2 * std::atan2(sinHalf, q.w) / sinHalf;
+            return {q.x * scale, q.y * scale, q.z * scale};
+        }
     };
 
 }// namespace kine
 
-#endif//KINE_IKSOLVER_HPP
\ No newline at end of file
+#endif//KINE_IKSOLVER_HPP
@@ -0,0 +1,124 @@
+
+#ifndef KINE_JACOBIANSOLVER_HPP
+#define KINE_JACOBIANSOLVER_HPP
+
+#include "kine/ik/IKSolver.hpp"
+
+#include "Eigen/Dense"
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+namespace kine {
+
+    // Common base of the solvers refining the joint values with the Jacobian against the position error (3 rows)
+    // or the weighted pose error (6 rows). Derived provides the update rule as
+    //
+    //   template<int Rows, class ErrorFunction>
+    //   void iterate(const Kine& kine, std::span<float> values, const Eigen::Vector<double, Rows>& weights, ErrorFunction computeError);
+    //
+    // where computeError(t, error) writes the unweighted error of the end-effector transformation t,
+    // position rows first. iterate starts the solve with beginSolve, judges convergence on the weighted error
+    // and reports the unweighted one through setResiduals.
+    template<class Derived>
+    class JacobianSolver: public IKSolver {
+
+    public:
+        using IKSolver::solveIK;
+
+        std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIKDetailed(kine, target, startValues).values;
+        }
+
+        IKResult solveIKDetailed(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIntoVector(kine, target, startValues);
+        }
+
+        IKStats solveIK(const Kine& kine, const Vector3& target, std::span<const float> startValues, std::span<float> result) override {
+
+            if (result.data() != startValues.data()) {
+                std::copy_n(startValues.begin(), kine.numDof(), result.begin());
+            }
+            solve(kine, target, result);
+            return endSolve();
+        }
+
+        // Solves for position and orientation at once, using the 6 x n Jacobian. Rows of the
+        // error and Jacobian are scaled by the weights, so a zero weight leaves that axis free.
+        std::vector<float> solveIK(const Kine& kine, const Vector3& position, const Quaternion& orientation,
+                                   const std::vector<float>& startValues, const PoseWeights& weights = {}) override {
+
+            auto vals = startValues;
+            solve(kine, position, orientation, vals, weights);
+            return vals;
+        }
+
+        // Refines values in place towards the target position.
+        void solve(const Kine& kine, const Vector3& target, std::span<float> values) {
+
+            derived().template iterate<3>(kine, values, Eigen::Vector3d::Ones(), PositionError{target});
+        }
+
+        // Refines values in place towards the target pose, see PoseWeights. The solve converges once the weighted
+        // error drops below eps, the residual reports the unweighted position distance and orientationResidual the angle left.
+        void solve(const Kine& kine, const Vector3& position, const Quaternion& orientation, std::span<float> values, const PoseWeights& weights = {}) {
+
+            const Eigen::Vector<double, 6> w{weights.position.x, weights.position.y, weights.position.z,
+                                             weights.orientation.x, weights.orientation.y, weights.orientation.z};
+            derived().template iterate<6>(kine, values, w, PoseError{position, orientation});
+        }
+
+        // Rotation angle (radians) between the end-effector and the target orientation after the last pose solve,
+        // zero after position solves.
+        [[nodiscard]] float orientationResidual() const {
+            return orientationResidual_;
+        }
+
+    protected:
+        float orientationResidual_{};
+
+        // Takes the residuals of the solve from the unweighted error at the values returned.
+        template<int Rows>
+        void setResiduals(const Eigen::Vector<double, Rows>& error) {
+            residual_ = static_cast<float>(error.template head<3>().norm());
+            if constexpr (Rows == 6) {
+                orientationResidual_ = static_cast<float>(error.template tail<3>().norm());
+            } else {
+                orientationResidual_ = 0;
+            }
+        }
+
+        struct PositionError {
+            const Vector3& target;
+
+            void operator()(const RigidTransform& t, Eigen::Vector3d& error) const {
+                const auto& e = t.elements;
+                error = {target.x - e[9], target.y - e[10], target.z - e[11]};
+            }
+        };
+
+        struct PoseError {
+            const Vector3& position;
+            const Quaternion& orientation;
+
+            void operator()(const RigidTransform& t, Eigen::Vector<double, 6>& error) const {
+                const auto& e = t.elements;
+                Quaternion actual;
+                actual.setFromRotationMatrix(t.toMatrix4());
+                const auto rotation = orientationError(orientation, actual);
+                error << position.x - e[9], position.y - e[10], position.z - e[11], rotation.x, rotation.y, rotation.z;
+            }
+        };
+
+    private:
+        Derived& derived() {
+            return static_cast<Derived&>(*this);
+        }
+    };
+
+}// namespace kine
+
+#endif//KINE_JACOBIANSOLVER_HPP
@@ -0,0 +1,179 @@
+
+#ifndef KINE_LMSOLVER_HPP
+#define KINE_LMSOLVER_HPP
+
+#include "kine/ik/JacobianSolver.hpp"
+
+#include "Eigen/Dense"
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+namespace kine {
+
+    // Levenberg-Marquardt solver. Unlike DLSSolver the damping adapts to how well the
+    // linearization predicted the last step: steps that reduce the error are accepted and relax the damping,
+    // steps that do not are rejected and the damping grows, turning the update into short gradient steps.
+    // Candidate values are projected onto the joint limits, and the solve stops early once the steps stall.
+    class LMSolver: public JacobianSolver<LMSolver> {
+
+    public:
+        // initialDamping is relative to the largest diagonal entry of J^T J at the start values.
+        explicit LMSolver(int maxIterations = 50, double initialDamping = 1e-3)
+            : maxIterations_(maxIterations),
+              initialDamping_(initialDamping) {}
+
+    private:
+        template<int Rows>
+        struct Workspace {
+            Eigen::Matrix<float, Rows, Eigen::Dynamic> jacobian;
+            Eigen::Matrix<double, Rows, Eigen::Dynamic> weighted;
+            Eigen::VectorXd scale;
+            Eigen::VectorXd step;
+            Eigen::VectorXd gradient;
+            Eigen::Vector<double, Rows> error;
+            Eigen::Vector<double, Rows> candidateError;
+            Eigen::Vector<double, Rows> unweightedError;
+            Eigen::LDLT<Eigen::Matrix<double, Rows, Rows>> ldlt;
+        };
+
+        int maxIterations_;
+        double initialDamping_;
+        Workspace<3> workspace3_;
+        Workspace<6> workspace6_;
+        std::vector<float> candidate_;
+
+        friend class JacobianSolver<LMSolver>;
+
+        template<int Rows, class ErrorFunction>
+        void iterate(const Kine& kine, std::span<float> values, const Eigen::Vector<double, Rows>& weights, ErrorFunction computeError) {
+
+            auto& ws = workspace<Rows>();
+
+            const auto numDof = static_cast<Eigen::Index>(kine.numDof());
+            if (ws.jacobian.cols() != numDof) {
+                ws.jacobian.resize(Rows, numDof);
+                ws.weighted.resize(Rows, numDof);
+                ws.scale.resize(numDof);
+                ws.step.resize(numDof);
+                ws.gradient.resize(numDof);
+            }
+            candidate_.resize(kine.numDof());
+
+            const auto& plan = kine.plan();
+            const auto& joints = kine.joints();
+            for (Eigen::Index k = 0; k < numDof; ++k) {
+                ws.scale[k] = jacobianScale(kine, k);
+                joints[k]->limit().clampWithinLimit(values[k]);
+            }
+
+            const std::span<float> jacobian(ws.jacobian.data(), static_cast<size_t>(ws.jacobian.size()));
+            const auto linearize = [&] {
+                if constexpr (Rows == 6) {
+                    kine.computePoseJacobian(values, jacobian);
+                } else {
+                    kine.computeJacobian(values, jacobian);
+                }
+                ++jacobianEvaluations_;
+                ws.weighted.noalias() = weights.asDiagonal() * ws.jacobian.template cast<double>() * ws.scale.asDiagonal();
+                ws.gradient.noalias() = ws.weighted.transpose().lazyProduct(ws.error);
+
+                // joints resting on a limit the descent direction points beyond are held fixed for this step,
+                // otherwise the projection keeps truncating the step, it gets rejected and the damping runs away
+                for (Eigen::Index k = 0; k < numDof; ++k) {
+                    const auto& limit = joints[k]->limit();
+                    const bool atMax = limit.max() && values[k] >= *limit.max() && ws.gradient[k] > 0;
+                    const bool atMin = limit.min() && values[k] <= *limit.min() && ws.gradient[k] < 0;
+                    if (atMax || atMin) {
+                        ws.weighted.col(k).setZero();
+                        ws.gradient[k] = 0;
+                    }
+                }
+            };
+
+            // only steps reducing the error are taken, so the values are always the best so far
+            beginSolve();
+
+            RigidTransform t;
+            plan.evaluate(values, false, t);
+            ++fkEvaluations_;
+            computeError(t, ws.error);
+            setResiduals(ws.error);
+            ws.error = weights.cwiseProduct(ws.error);
+            double cost = 0.5 * ws.error.squaredNorm();
+            if (ws.error.norm() < eps_) {
+                converged_ = true;
+                return;
+            }
+
+            linearize();
+            double mu = initialDamping_ * ws.weighted.colwise().squaredNorm().maxCoeff();
+            double nu = 2;
+
+            for (int i = 0; i < maxIterations_ && nextIteration(); ++i) {
+
+                // h = (J^T J + mu I)^-1 J^T e = J^T (J J^T + mu I)^-1 e, solved in the small Rows x Rows form
+                Eigen::Matrix<double, Rows, Rows> jjt = ws.weighted.lazyProduct(ws.weighted.transpose());
+                jjt.diagonal().array() += mu;
+                ws.ldlt.compute(jjt);
+                ws.candidateError = ws.ldlt.solve(ws.error);
+                ws.step.noalias() = ws.weighted.transpose().lazyProduct(ws.candidateError);
+
+                // stalled, the steps (radians or length units) no longer move the joints noticeably
+                if (ws.step.template lpNorm<Eigen::Infinity>() < stallTolerance) break;
+
+                for (Eigen::Index k = 0; k < numDof; ++k) {
+                    candidate_[k] = values[k] + static_cast<float>(ws.scale[k] * ws.step[k]);
+                    joints[k]->limit().clampWithinLimit(candidate_[k]);
+                }
+
+                plan.evaluate(candidate_, false, t);
+                ++fkEvaluations_;
+                computeError(t, ws.unweightedError);
+                ws.candidateError = weights.cwiseProduct(ws.unweightedError);
+                const double candidateCost = 0.5 * ws.candidateError.squaredNorm();
+
+                // ratio of actual to predicted cost reduction, the prediction being 1/2 h^T (mu h + J^T e)
+                const double predicted = 0.5 * ws.step.dot(mu * ws.step + ws.gradient);
+                const double rho = predicted > 0 ? (cost - candidateCost) / predicted : -1;
+
+                if (rho > 0) {
+                    std::copy(candidate_.begin(), candidate_.end(), values.begin());
+                    ws.error = ws.candidateError;
+                    cost = candidateCost;
+                    setResiduals(ws.unweightedError);
+                    if (ws.error.norm() < eps_) {
+                        converged_ = true;
+                        break;
+                    }
+
+                    linearize();
+                    mu *= std::max(1.0 / 3, 1 - std::pow(2 * rho - 1, 3));
+                    nu = 2;
+                } else {
+                    mu *= nu;
+                    nu *= 2;
+                    // the damping has grown so large that no step can make progress
+                    if (nu > maxDampingGrowth) break;
+                }
+            }
+        }
+
+        template<int Rows>
+        Workspace<Rows>& workspace() {
+            if constexpr (Rows == 6) {
+                return workspace6_;
+            } else {
+                return workspace3_;
+            }
+        }
+
+        static constexpr double stallTolerance = 1e-7;
+        static constexpr double maxDampingGrowth = 1e12;
+    };
+
+}// namespace kine
+
+#endif//KINE_LMSOLVER_HPP
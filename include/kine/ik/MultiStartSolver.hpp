@@ -0,0 +1,156 @@
+
+#ifndef KINE_MULTISTARTSOLVER_HPP
+#define KINE_MULTISTARTSOLVER_HPP
+
+#include "kine/WorkStealingPool.hpp"
+#include "kine/ik/IKSolver.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace kine {
+
+    // Runs a solver from several start configurations in parallel and returns the best result.
+    // The starts are the caller's start values, Kine::meanAngles and random configurations within the joint limits.
+    // The worker threads are kept in a WorkStealingPool for the lifetime of the solver, so a solve only wakes them.
+    // Each owns a solver created by the factory, which takes over eps, and works through the starts in that order.
+    // As soon as one result ends up within eps of the target (see setEPS), the others are cancelled through their
+    // stop token, so a hard target costs about as much as its luckiest start instead of a serial sequence of retries.
+    // A time budget covers the whole solve, an iteration budget applies to every start.
+    class MultiStartSolver: public IKSolver {
+
+    public:
+        using SolverFactory = std::function<std::unique_ptr<IKSolver>()>;
+
+        explicit MultiStartSolver(const SolverFactory& factory, unsigned int numStarts = 8,
+                                  unsigned int numThreads = std::thread::hardware_concurrency(), unsigned int seed = 42)
+            : numStarts_(std::max(1u, numStarts)),
+              pool_(std::clamp(numThreads, 1u, numStarts_)),
+              gen_(seed) {
+
+            for (size_t i = 0; i < pool_.size(); ++i) {
+                solvers_.emplace_back(factory());
+            }
+        }
+
+        using IKSolver::solveIK;
+
+        std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIKDetailed(kine, target, startValues).values;
+        }
+
+        // The counts add up the work of all starts, including those cancelled early.
+        IKResult solveIKDetailed(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            beginSolve();
+            generateStarts(kine, startValues);
+
+            // cancelling this solver cancels the starts as well
+            std::stop_source stop;
+            std::stop_callback forward(stopToken_, [&] { stop.request_stop(); });
+
+            std::atomic<size_t> next{0};
+            std::mutex mutex;
+            std::vector<float> best;
+            float bestError = std::numeric_limits<float>::max();
+
+            // one task per worker, each pulling the next start until they run out or the solve is stopped
+            pool_.parallelFor(pool_.size(), [&](size_t, size_t worker) {
+                auto& solver = *solvers_[worker];
+                solver.setEPS(eps_);
+                solver.setStopToken(stop.get_token());
+                try {
+                    for (size_t i = next++; i < starts_.size() && !stop.stop_requested(); i = next++) {
+
+                        // every start gets the iteration budget, and what is left of the time budget
+                        IKBudget budget{std::chrono::microseconds(0), budget_.iterations};
+                        if (deadline_ != Clock::time_point::max()) {
+                            const auto remaining = std::chrono::ceil<std::chrono::microseconds>(deadline_ - Clock::now());
+                            if (remaining.count() <= 0) {
+                                std::lock_guard lock(mutex);
+                                termination_ = IKTermination::BudgetExhausted;
+                                break;
+                            }
+                            budget.time = remaining;
+                        }
+                        solver.setBudget(budget);
+
+                        auto result = solver.solveIKDetailed(kine, target, starts_[i]);
+
+                        std::lock_guard lock(mutex);
+                        accumulate(result);
+                        if (result.residual < bestError) {
+                            best = std::move(result.values);
+                            bestError = result.residual;
+                        }
+                        if (bestError < eps_) stop.request_stop();
+                    }
+                } catch (...) {
+                    // the pool rethrows the first exception once the other workers have stopped
+                    stop.request_stop();
+                    throw;
+                }
+            });
+
+            // all starts were cancelled before one finished
+            if (best.empty()) {
+                best = startValues;
+                RigidTransform t;
+                kine.plan().evaluate(best, false, t);
+                bestError = t.getPosition().distanceTo(target);
+            }
+            residual_ = bestError;
+            converged_ = bestError < eps_;
+            // starts skipped by the caller's cancellation never reported it themselves
+            if (stopRequested()) termination_ = IKTermination::Cancelled;
+
+            return {endSolve(), std::move(best)};
+        }
+
+    private:
+        unsigned int numStarts_;
+        WorkStealingPool pool_;
+        std::vector<std::unique_ptr<IKSolver>> solvers_;
+        std::vector<std::vector<float>> starts_;
+        std::mt19937 gen_;
+
+        void generateStarts(const Kine& kine, const std::vector<float>& startValues) {
+
+            const auto& plan = kine.plan();
+            const size_t numDof = kine.numDof();
+            starts_.resize(numStarts_);
+            starts_[0].assign(startValues.begin(), startValues.end());
+            if (numStarts_ > 1) {
+                starts_[1].resize(numDof);
+                kine.meanAngles(starts_[1]);
+            }
+
+            std::uniform_real_distribution<float> dist(0, 1);
+            for (size_t s = 2; s < numStarts_; ++s) {
+                auto& values = starts_[s];
+                values.resize(numDof);
+                for (size_t j = 0; j < numDof; ++j) {
+                    const auto& limit = kine.joints()[j]->limit();
+                    const bool revolute = plan.steps()[plan.jointStep(j)].type == FKPlan::StepType::Revolute;
+                    // prismatic joints open on one side are sampled at their bound
+                    const float lower = limit.min().value_or(revolute ? -180.f : limit.max().value_or(0.f));
+                    const float upper = limit.max().value_or(revolute ? 180.f : limit.min().value_or(0.f));
+                    values[j] = lower + dist(gen_) * (upper - lower);
+                }
+            }
+        }
+    };
+
+}// namespace kine
+
+#endif//KINE_MULTISTARTSOLVER_HPP
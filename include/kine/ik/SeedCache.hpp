@@ -0,0 +1,251 @@
+
+#ifndef KINE_SEEDCACHE_HPP
+#define KINE_SEEDCACHE_HPP
+
+#include "kine/ik/IKSolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace kine {
+
+    // Joint solutions of recently solved targets, keyed on a uniform grid over the target positions.
+    // Holds at most capacity entries, the least recently stored or used one is replaced once full.
+    // Lookups only search the cell of the target and its neighbours, so they take constant time.
+    class SeedCache {
+
+    public:
+        struct Stats {
+            size_t hits{};
+            size_t misses{};
+            size_t evictions{};
+
+            [[nodiscard]] float hitRate() const {
+                const size_t lookups = hits + misses;
+                return lookups == 0 ? 0.f : static_cast<float>(hits) / static_cast<float>(lookups);
+            }
+        };
+
+        // cellSize is the grid spacing in length units, lookups return solutions stored up to one cell away.
+        explicit SeedCache(float cellSize = 0.5f, size_t capacity = 1024)
+            : cellSize_(cellSize),
+              capacity_(capacity) {}
+
+        // The solution stored for the target nearest to the given one, or nullptr if there is none within reach.
+        // The returned values stay valid until the next call to store or clear.
+        const std::vector<float>* lookup(const Vector3& target) {
+
+            const Cell center = cellOf(target);
+            EntryList::iterator nearest = entries_.end();
+            float nearestDistance = std::numeric_limits<float>::max();
+            for (int dx = -1; dx <= 1; ++dx) {
+                for (int dy = -1; dy <= 1; ++dy) {
+                    for (int dz = -1; dz <= 1; ++dz) {
+                        const auto it = cells_.find({center.x + dx, center.y + dy, center.z + dz});
+                        if (it == cells_.end()) continue;
+                        for (const auto& entry : it->second) {
+                            const float d = entry->target.distanceToSquared(target);
+                            if (d < nearestDistance) {
+                                nearest = entry;
+                                nearestDistance = d;
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (nearest == entries_.end()) {
+                ++stats_.misses;
+                return nullptr;
+            }
+
+            ++stats_.hits;
+            entries_.splice(entries_.begin(), entries_, nearest);
+            return &nearest->values;
+        }
+
+        // Stores the solution of target, replacing the entry of a target closer than mergeDistance() to it.
+        void store(const Vector3& target, std::span<const float> values) {
+
+            if (capacity_ == 0) return;
+
+            const Cell cell = cellOf(target);
+            auto& bucket = cells_[cell];
+            for (const auto& entry : bucket) {
+                if (entry->target.distanceTo(target) < mergeDistance()) {
+                    entry->target = target;
+                    entry->values.assign(values.begin(), values.end());
+                    entries_.splice(entries_.begin(), entries_, entry);
+                    return;
+                }
+            }
+
+            if (entries_.size() < capacity_) {
+                entries_.emplace_front();
+            } else {
+                // reuse the least recently used entry, keeping its storage
+                unlink(std::prev(entries_.end()));
+                entries_.splice(entries_.begin(), entries_, std::prev(entries_.end()));
+                ++stats_.evictions;
+            }
+
+            auto& entry = entries_.front();
+            entry.target = target;
+            entry.cell = cell;
+            entry.values.assign(values.begin(), values.end());
+            cells_[cell].emplace_back(entries_.begin());
+        }
+
+        void clear() {
+            entries_.clear();
+            cells_.clear();
+        }
+
+        [[nodiscard]] size_t size() const {
+            return entries_.size();
+        }
+
+        [[nodiscard]] const Stats& stats() const {
+            return stats_;
+        }
+
+        void resetStats() {
+            stats_ = {};
+        }
+
+    private:
+        struct Cell {
+            int x, y, z;
+
+            bool operator==(const Cell&) const = default;
+        };
+
+        struct CellHash {
+            size_t operator()(const Cell& c) const {
+                // large primes, as commonly used for spatial hashing
+                return static_cast<size_t>(c.x) * 73856093u ^ static_cast<size_t>(c.y) * 19349663u ^ static_cast<size_t>(c.z) * 83492791u;
+            }
+        };
+
+        struct Entry {
+            Vector3 target;
+            Cell cell{};
+            std::vector<float> values;
+        };
+
+        // most recently used first
+        using EntryList = std::list<Entry>;
+
+        float cellSize_;
+        size_t capacity_;
+        EntryList entries_;
+        std::unordered_map<Cell, std::vector<EntryList::iterator>, CellHash> cells_;
+        Stats stats_;
+
+        [[nodiscard]] float mergeDistance() const {
+            return cellSize_ * 0.01f;
+        }
+
+        [[nodiscard]] Cell cellOf(const Vector3& p) const {
+            return {static_cast<int>(std::floor(p.x / cellSize_)),
+                    static_cast<int>(std::floor(p.y / cellSize_)),
+                    static_cast<int>(std::floor(p.z / cellSize_))};
+        }
+
+        // Removes entry from its cell, leaving it in the list.
+        void unlink(EntryList::iterator entry) {
+            const auto it = cells_.find(entry->cell);
+            auto& bucket = it->second;
+            bucket.erase(std::find(bucket.begin(), bucket.end(), entry));
+            if (bucket.empty()) cells_.erase(it);
+        }
+    };
+
+    // Wraps a solver, seeding every position solve with the cached solution of the nearest recently solved target.
+    // Solutions ending up within eps of their target (see setEPS, which the wrapped solver takes over) are stored.
+    // Targets without a cached neighbour start from the given start values. Pose solves are passed on to the wrapped solver unchanged.
+    // The cache is tied to one Kine and cleared when solving for another.
+    class SeedCachedSolver: public IKSolver {
+
+    public:
+        explicit SeedCachedSolver(std::unique_ptr<IKSolver> solver, float cellSize = 0.5f, size_t capacity = 1024)
+            : solver_(std::move(solver)),
+              cache_(cellSize, capacity) {}
+
+        using IKSolver::solveIK;
+
+        std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIKDetailed(kine, target, startValues).values;
+        }
+
+        IKResult solveIKDetailed(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) override {
+
+            return solveIntoVector(kine, target, startValues);
+        }
+
+        IKStats solveIK(const Kine& kine, const Vector3& target, std::span<const float> startValues, std::span<float> result) override {
+
+            if (&kine != kine_) {
+                cache_.clear();
+                kine_ = &kine;
+            }
+
+            beginSolve();
+            forwardSettings();
+
+            const auto* seed = cache_.lookup(target);
+            const auto stats = solver_->solveIK(kine, target, seed ? std::span<const float>(*seed) : startValues, result);
+            accumulate(stats);
+
+            residual_ = stats.residual;
+            converged_ = residual_ < eps_;
+            if (converged_) {
+                cache_.store(target, result.first(kine.numDof()));
+            }
+
+            return endSolve();
+        }
+
+        std::vector<float> solveIK(const Kine& kine, const Vector3& position, const Quaternion& orientation,
+                                   const std::vector<float>& startValues, const PoseWeights& weights = {}) override {
+
+            beginSolve();
+            forwardSettings();
+            auto values = solver_->solveIK(kine, position, orientation, startValues, weights);
+            residual_ = solver_->residual();
+            converged_ = solver_->converged();
+            return values;
+        }
+
+        [[nodiscard]] SeedCache& cache() {
+            return cache_;
+        }
+
+        [[nodiscard]] const SeedCache& cache() const {
+            return cache_;
+        }
+
+    private:
+        std::unique_ptr<IKSolver> solver_;
+        SeedCache cache_;
+        const Kine* kine_{nullptr};
+
+        void forwardSettings() {
+            solver_->setEPS(eps_);
+            solver_->setBudget(budget_);
+            solver_->setStopToken(stopToken_);
+        }
+    };
+
+}// namespace kine
+
+#endif//KINE_SEEDCACHE_HPP
@@ -0,0 +1,72 @@
+
+#ifndef KINE_WORKSPACEINDEX_HPP
+#define KINE_WORKSPACEINDEX_HPP
+
+#include "kine/Kine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace kine {
+
+    // Nearest-neighbour index from end-effector position to joint configuration, built from sampled configurations.
+    // Used to seed iterative solvers close to the solution. Samples are kept as an implicit KD-tree:
+    // the median along the split axis of every subrange sits in its middle, so no nodes or pointers are stored,
+    // and a saved index is memory-mapped by load without any parsing.
+    // An index is immutable, copies share the same storage and can be queried from several threads.
+    class WorkspaceIndex {
+
+    public:
+        // Samples numSamples configurations uniformly within the joint limits. Revolute joints without limits span
+        // [-180, 180], those limited on one side span a full turn from their bound.
+        // Throws std::invalid_argument for prismatic joints missing either limit and for inverted limits.
+        static WorkspaceIndex build(const Kine& kine, size_t numSamples, unsigned int seed = 42);
+
+        // Maps an index written by save. Throws std::runtime_error if the file is not a valid index for kine.
+        static WorkspaceIndex load(const std::filesystem::path& path, const Kine& kine);
+
+        // Writes the index in native byte order.
+        void save(const std::filesystem::path& path) const;
+
+        [[nodiscard]] size_t size() const {
+            return size_;
+        }
+
+        [[nodiscard]] size_t numDof() const {
+            return numDof_;
+        }
+
+        // Index of the sample whose end-effector position is closest to target.
+        [[nodiscard]] size_t nearest(const Vector3& target) const;
+
+        [[nodiscard]] Vector3 position(size_t i) const {
+            return {points_[3 * i], points_[3 * i + 1], points_[3 * i + 2]};
+        }
+
+        // Joint values (denormalized) of sample i.
+        [[nodiscard]] std::span<const float> configuration(size_t i) const {
+            return {configurations_ + i * numDof_, numDof_};
+        }
+
+        // Copies the configuration of the sample nearest to target into seed and returns its distance to target.
+        float seed(const Vector3& target, std::span<float> seed) const;
+
+    private:
+        size_t size_{};
+        size_t numDof_{};
+        // identifies the chain the index was built for
+        uint64_t fingerprint_{};
+        // keeps the points and configurations alive, owned memory or a file mapping
+        std::shared_ptr<const void> storage_;
+        const float* points_{nullptr};
+        const float* configurations_{nullptr};
+
+        WorkspaceIndex() = default;
+    };
+
+}// namespace kine
+
+#endif//KINE_WORKSPACEINDEX_HPP
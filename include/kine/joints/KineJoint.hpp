@@ -2,6 +2,8 @@
 #ifndef KINE_JOINT_HPP
 #define KINE_JOINT_HPP
 
+#include <cmath>
+
 #include "kine/math/Matrix4.hpp"
 #include "kine/math/Vector3.hpp"
 
@@ -10,38 +12,58 @@
 
 namespace kine {
 
+    // A single degree of freedom. Joints are immutable once constructed, the joint value
+    // is supplied per call so one joint can be evaluated concurrently from several threads.
     class KineJoint: public KineComponent {
 
     public:
         KineJoint(const Vector3& axis, const KineLimit& limit)
             : axis_(axis),
-              limit_(limit){};
-
-        [[nodiscard]] float getJointValue() const {
-            return value_;
-        }
+              limit_(limit),
+              principalAxis_(findPrincipalAxis(axis)){};
 
         [[nodiscard]] const Vector3& axis() const { return axis_; }
 
-        [[nodiscard]] const KineLimit& limit() const { return limit_; }
+        // Index of the principal axis (0 = X, 1 = Y, 2 = Z) the joint axis equals in either direction, or -1.
+        [[nodiscard]] int principalAxis() const { return principalAxis_; }
 
-        void setJointValue(float value) {
-            value_ = value;
-            limit_.clampWithinLimit(value_);
+        // The component of the joint axis along its principal axis, i.e. 1 or -1.
+        [[nodiscard]] float principalAxisSign() const {
+            const float components[] = {axis_.x, axis_.y, axis_.z};
+            return principalAxis_ < 0 ? 1.f : components[principalAxis_];
         }
 
+        [[nodiscard]] const KineLimit& limit() const { return limit_; }
+
+        // The transformation at joint value zero.
         [[nodiscard]] Matrix4 getTransformation() const override {
-            return getTransformation(value_);
+            return getTransformation(0);
         }
 
-        [[nodiscard]] virtual Matrix4 getTransformation(float value) const = 0;
+        [[nodiscard]] virtual Matrix4 getTransformation(float value) const {
+            return getRigidTransformation(value).toMatrix4();
+        }
+
+        [[nodiscard]] RigidTransform getRigidTransformation() const override {
+            return getRigidTransformation(0);
+        }
+
+        [[nodiscard]] virtual RigidTransform getRigidTransformation(float value) const = 0;
 
     protected:
         Vector3 axis_;
         KineLimit limit_;
+        int principalAxis_;
 
     private:
-        float value_{};
+        static int findPrincipalAxis(const Vector3& axis) {
+            const float components[] = {axis.x, axis.y, axis.z};
+            for (int i = 0; i < 3; ++i) {
+                const int j = (i + 1) % 3, k = (i + 2) % 3;
+                if (std::abs(components[i]) == 1 && components[j] == 0 && components[k] == 0) return i;
+            }
+            return -1;
+        }
     };
 
 }// namespace kine
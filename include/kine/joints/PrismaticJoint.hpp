@@ -11,13 +11,14 @@ namespace kine {
     public:
         PrismaticJoint(const Vector3& axis, KineLimit limit): KineJoint(axis, limit) {}
 
-        [[nodiscard]] Matrix4 getTransformation(float value) const override {
-            return Matrix4().makeTranslation(tmp_.copy(axis_).multiplyScalar(value));
-        }
-
+        using KineJoint::getRigidTransformation;
 
-    private:
-        mutable Vector3 tmp_;
+        [[nodiscard]] RigidTransform getRigidTransformation(float value) const override {
+            if (principalAxis_ < 0) {
+                return RigidTransform().makeTranslation(axis_ * value);
+            }
+            return RigidTransform().translatePrincipal(principalAxis_, principalAxisSign() * value);
+        }
     };
 
 }// namespace kine
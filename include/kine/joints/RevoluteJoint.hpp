@@ -13,8 +13,14 @@ namespace kine {
     public:
         RevoluteJoint(const Vector3& axis, KineLimit limit): KineJoint(axis, limit) {}
 
-        [[nodiscard]] Matrix4 getTransformation(float value) const override {
-            return Matrix4().makeRotationAxis(axis_, value * DEG2RAD);
+        using KineJoint::getRigidTransformation;
+
+        [[nodiscard]] RigidTransform getRigidTransformation(float value) const override {
+            const float angle = value * DEG2RAD;
+            if (principalAxis_ < 0) {
+                return RigidTransform().makeRotationAxis(axis_, angle);
+            }
+            return RigidTransform().rotatePrincipal(principalAxis_, std::cos(angle), principalAxisSign() * std::sin(angle));
         }
     };
 
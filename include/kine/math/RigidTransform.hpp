@@ -0,0 +1,260 @@
+
+#ifndef KINE_RIGIDTRANSFORM_HPP
+#define KINE_RIGIDTRANSFORM_HPP
+
+#include <array>
+#include <cmath>
+#include <ostream>
+#include <utility>
+
+#include "kine/math/Matrix4.hpp"
+#include "kine/math/Vector3.hpp"
+
+namespace kine {
+
+    // A rigid transformation, i.e. a 3x3 rotation followed by a translation.
+    // Equivalent to a Matrix4 with an implicit (0, 0, 0, 1) bottom row, which lets composition,
+    // inversion and point transformation skip the work that row would otherwise require.
+    class RigidTransform {
+
+    public:
+        // Column-major, same layout as the upper three rows of Matrix4::elements.
+        std::array<float, 12> elements{
+                1.f, 0.f, 0.f,
+                0.f, 1.f, 0.f,
+                0.f, 0.f, 1.f,
+                0.f, 0.f, 0.f};
+
+        RigidTransform() = default;
+
+        // Resets this transformation to the identity.
+        RigidTransform& identity() {
+            elements = {1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0};
+
+            return *this;
+        }
+
+        // Copies the rotation and translation of m, which is assumed to be affine.
+        RigidTransform& setFromMatrix4(const Matrix4& m) {
+            const auto& me = m.elements;
+            elements = {me[0], me[1], me[2], me[4], me[5], me[6], me[8], me[9], me[10], me[12], me[13], me[14]};
+
+            return *this;
+        }
+
+        [[nodiscard]] Matrix4 toMatrix4() const {
+            Matrix4 m;
+            const auto& te = elements;
+            m.elements = {te[0], te[1], te[2], 0,
+                          te[3], te[4], te[5], 0,
+                          te[6], te[7], te[8], 0,
+                          te[9], te[10], te[11], 1};
+
+            return m;
+        }
+
+        [[nodiscard]] Vector3 getPosition() const {
+            return {elements[9], elements[10], elements[11]};
+        }
+
+        // Sets the translation without affecting the rotation.
+        RigidTransform& setPosition(float x, float y, float z) {
+            elements[9] = x;
+            elements[10] = y;
+            elements[11] = z;
+
+            return *this;
+        }
+
+        RigidTransform& setPosition(const Vector3& v) {
+            return setPosition(v.x, v.y, v.z);
+        }
+
+        // Sets this transformation as a pure translation.
+        RigidTransform& makeTranslation(float x, float y, float z) {
+            elements = {1, 0, 0, 0, 1, 0, 0, 0, 1, x, y, z};
+
+            return *this;
+        }
+
+        RigidTransform& makeTranslation(const Vector3& v) {
+            return makeTranslation(v.x, v.y, v.z);
+        }
+
+        // Sets this transformation as a rotation of angle radians around the normalized axis.
+        RigidTransform& makeRotationAxis(const Vector3& axis, float angle) {
+
+            // same formulation as Matrix4::makeRotationAxis
+            const float c = std::cos(angle);
+            const float s = std::sin(angle);
+            const float t = 1 - c;
+            const float x = axis.x, y = axis.y, z = axis.z;
+            const float tx = t * x, ty = t * y;
+
+            elements = {tx * x + c, tx * y + s * z, tx * z - s * y,
+                        tx * y - s * z, ty * y + c, ty * z + s * x,
+                        tx * z + s * y, ty * z - s * x, t * z * z + c,
+                        0, 0, 0};
+
+            return *this;
+        }
+
+        // Post-multiplies this transformation by m.
+        RigidTransform& multiply(const RigidTransform& m) {
+            return multiplyTransforms(*this, m);
+        }
+
+        // Pre-multiplies this transformation by m.
+        RigidTransform& premultiply(const RigidTransform& m) {
+            return multiplyTransforms(m, *this);
+        }
+
+        // Sets this transformation to a x b.
+        RigidTransform& multiplyTransforms(const RigidTransform& a, const RigidTransform& b) {
+
+            const auto& ae = a.elements;
+            const auto& be = b.elements;
+
+            const float a11 = ae[0], a12 = ae[3], a13 = ae[6], a14 = ae[9];
+            const float a21 = ae[1], a22 = ae[4], a23 = ae[7], a24 = ae[10];
+            const float a31 = ae[2], a32 = ae[5], a33 = ae[8], a34 = ae[11];
+
+            const float b11 = be[0], b12 = be[3], b13 = be[6], b14 = be[9];
+            const float b21 = be[1], b22 = be[4], b23 = be[7], b24 = be[10];
+            const float b31 = be[2], b32 = be[5], b33 = be[8], b34 = be[11];
+
+            auto& te = elements;
+
+            te[0] = a11 * b11 + a12 * b21 + a13 * b31;
+            te[3] = a11 * b12 + a12 * b22 + a13 * b32;
+            te[6] = a11 * b13 + a12 * b23 + a13 * b33;
+            te[9] = a11 * b14 + a12 * b24 + a13 * b34 + a14;
+
+            te[1] = a21 * b11 + a22 * b21 + a23 * b31;
+            te[4] = a21 * b12 + a22 * b22 + a23 * b32;
+            te[7] = a21 * b13 + a22 * b23 + a23 * b33;
+            te[10] = a21 * b14 + a22 * b24 + a23 * b34 + a24;
+
+            te[2] = a31 * b11 + a32 * b21 + a33 * b31;
+            te[5] = a31 * b12 + a32 * b22 + a33 * b32;
+            te[8] = a31 * b13 + a32 * b23 + a33 * b33;
+            te[11] = a31 * b14 + a32 * b24 + a33 * b34 + a34;
+
+            return *this;
+        }
+
+        // Post-multiplies this transformation by a translation of (x, y, z).
+        RigidTransform& translate(float x, float y, float z) {
+            auto& te = elements;
+            te[9] += te[0] * x + te[3] * y + te[6] * z;
+            te[10] += te[1] * x + te[4] * y + te[7] * z;
+            te[11] += te[2] * x + te[5] * y + te[8] * z;
+
+            return *this;
+        }
+
+        // Post-multiplies this transformation by a rotation of angle radians around the X axis.
+        RigidTransform& rotateX(float angle) {
+            return rotatePrincipal(0, std::cos(angle), std::sin(angle));
+        }
+
+        // Post-multiplies this transformation by a rotation of angle radians around the Y axis.
+        RigidTransform& rotateY(float angle) {
+            return rotatePrincipal(1, std::cos(angle), std::sin(angle));
+        }
+
+        // Post-multiplies this transformation by a rotation of angle radians around the Z axis.
+        RigidTransform& rotateZ(float angle) {
+            return rotatePrincipal(2, std::cos(angle), std::sin(angle));
+        }
+
+        // Post-multiplies this transformation by a rotation around principal axis 0 (X), 1 (Y) or 2 (Z),
+        // given the cosine and sine of the angle. Only the two columns orthogonal to the axis change.
+        RigidTransform& rotatePrincipal(int axis, float c, float s) {
+            const int i = (axis + 1) % 3, j = (axis + 2) % 3;
+            auto& te = elements;
+            for (int row = 0; row < 3; ++row) {
+                const float ci = te[i * 3 + row], cj = te[j * 3 + row];
+                te[i * 3 + row] = c * ci + s * cj;
+                te[j * 3 + row] = c * cj - s * ci;
+            }
+
+            return *this;
+        }
+
+        // Post-multiplies this transformation by a rotation around the normalized axis,
+        // given the cosine and sine of the angle. The translation is left untouched.
+        RigidTransform& rotateOnAxis(const Vector3& axis, float c, float s) {
+
+            const float t = 1 - c;
+            const float x = axis.x, y = axis.y, z = axis.z;
+            const float tx = t * x, ty = t * y;
+
+            // rows of the rotation, same formulation as Matrix4::makeRotationAxis
+            const float m11 = tx * x + c, m12 = tx * y - s * z, m13 = tx * z + s * y;
+            const float m21 = tx * y + s * z, m22 = ty * y + c, m23 = ty * z - s * x;
+            const float m31 = tx * z - s * y, m32 = ty * z + s * x, m33 = t * z * z + c;
+
+            auto& te = elements;
+            for (int row = 0; row < 3; ++row) {
+                const float r1 = te[row], r2 = te[3 + row], r3 = te[6 + row];
+                te[row] = r1 * m11 + r2 * m21 + r3 * m31;
+                te[3 + row] = r1 * m12 + r2 * m22 + r3 * m32;
+                te[6 + row] = r1 * m13 + r2 * m23 + r3 * m33;
+            }
+
+            return *this;
+        }
+
+        // Post-multiplies this transformation by a translation of distance along principal axis 0 (X), 1 (Y) or 2 (Z).
+        RigidTransform& translatePrincipal(int axis, float distance) {
+            auto& te = elements;
+            te[9] += te[axis * 3] * distance;
+            te[10] += te[axis * 3 + 1] * distance;
+            te[11] += te[axis * 3 + 2] * distance;
+
+            return *this;
+        }
+
+        // Inverts this transformation. The rotation is orthonormal, so its inverse is its transpose.
+        RigidTransform& invert() {
+
+            auto& te = elements;
+            const float tx = te[9], ty = te[10], tz = te[11];
+
+            std::swap(te[1], te[3]);
+            std::swap(te[2], te[6]);
+            std::swap(te[5], te[7]);
+
+            te[9] = -(te[0] * tx + te[3] * ty + te[6] * tz);
+            te[10] = -(te[1] * tx + te[4] * ty + te[7] * tz);
+            te[11] = -(te[2] * tx + te[5] * ty + te[8] * tz);
+
+            return *this;
+        }
+
+        // Returns p transformed by this transformation.
+        [[nodiscard]] Vector3 transformPoint(const Vector3& p) const {
+            const auto& e = elements;
+            return {e[0] * p.x + e[3] * p.y + e[6] * p.z + e[9],
+                    e[1] * p.x + e[4] * p.y + e[7] * p.z + e[10],
+                    e[2] * p.x + e[5] * p.y + e[8] * p.z + e[11]};
+        }
+
+        // Returns d rotated by this transformation, ignoring the translation.
+        [[nodiscard]] Vector3 transformDirection(const Vector3& d) const {
+            const auto& e = elements;
+            return {e[0] * d.x + e[3] * d.y + e[6] * d.z,
+                    e[1] * d.x + e[4] * d.y + e[7] * d.z,
+                    e[2] * d.x + e[5] * d.y + e[8] * d.z};
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, const RigidTransform& t) {
+            os << t.toMatrix4();
+            return os;
+        }
+    };
+
+}// namespace kine
+
+#endif//KINE_RIGIDTRANSFORM_HPP
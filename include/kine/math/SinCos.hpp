@@ -0,0 +1,23 @@
+
+#ifndef KINE_SINCOS_HPP
+#define KINE_SINCOS_HPP
+
+#include <span>
+
+namespace kine {
+
+    // Accuracy tiers of the vectorized sincos, the bounds are maximum absolute errors for |angle| <= 1e4 radians.
+    enum class SinCosAccuracy {
+        // ~1e-7, comparable to std::sin/std::cos in single precision
+        Precise,
+        // ~1.5e-5, two polynomial terms less and a cheaper range reduction
+        Fast
+    };
+
+    // Computes the sine and cosine of every angle (in radians), 8 angles at a time.
+    // sines and cosines must hold at least angles.size() elements.
+    void sincos(std::span<const float> angles, std::span<float> sines, std::span<float> cosines, SinCosAccuracy accuracy = SinCosAccuracy::Precise);
+
+}// namespace kine
+
+#endif//KINE_SINCOS_HPP
@@ -0,0 +1,222 @@
+
+#include "kine/FKPlan.hpp"
+
+#include "kine/simd/Lanes.hpp"
+#include "kine/simd/SinCos.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+using namespace kine;
+using simd::Lanes;
+
+namespace {
+
+    // Affine 3x4 transformation, one configuration per lane.
+    struct LaneTransform {
+        // r[row][col]
+        Lanes r[3][3];
+        Lanes t[3];
+
+        LaneTransform() {
+            const auto zero = Lanes::broadcast(0);
+            const auto one = Lanes::broadcast(1);
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    r[i][j] = i == j ? one : zero;
+                }
+                t[i] = zero;
+            }
+        }
+
+        // this = this * m, where m is the upper 3x3 of a constant matrix
+        void rotate(const float m[3][3]) {
+            for (auto& row : r) {
+                const Lanes r0 = row[0], r1 = row[1], r2 = row[2];
+                for (int j = 0; j < 3; ++j) {
+                    row[j] = fma(r0, Lanes::broadcast(m[0][j]), fma(r1, Lanes::broadcast(m[1][j]), r2 * Lanes::broadcast(m[2][j])));
+                }
+            }
+        }
+
+        // this = this * m, where m is a per-lane rotation
+        void rotate(const Lanes m[3][3]) {
+            for (auto& row : r) {
+                const Lanes r0 = row[0], r1 = row[1], r2 = row[2];
+                for (int j = 0; j < 3; ++j) {
+                    row[j] = fma(r0, m[0][j], fma(r1, m[1][j], r2 * m[2][j]));
+                }
+            }
+        }
+
+        // this = this * rotation around principal axis, only the two columns orthogonal to it change
+        void rotatePrincipal(int axis, const Lanes& c, const Lanes& s) {
+            const int i = (axis + 1) % 3, j = (axis + 2) % 3;
+            for (auto& row : r) {
+                const Lanes ci = row[i], cj = row[j];
+                row[i] = fma(c, ci, s * cj);
+                row[j] = fma(c, cj, Lanes::broadcast(0) - s * ci);
+            }
+        }
+
+        // this = this * translation(v)
+        void translate(const Lanes& x, const Lanes& y, const Lanes& z) {
+            for (int i = 0; i < 3; ++i) {
+                t[i] = fma(r[i][0], x, fma(r[i][1], y, fma(r[i][2], z, t[i])));
+            }
+        }
+    };
+
+    Lanes loadJointValues(const float* values, size_t remaining) {
+        if (remaining >= Lanes::size) return Lanes::load(values);
+
+        // pad the last group by repeating the final configuration
+        float tmp[Lanes::size];
+        for (size_t i = 0; i < Lanes::size; ++i) {
+            tmp[i] = values[std::min(i, remaining - 1)];
+        }
+        return Lanes::load(tmp);
+    }
+
+    void sinCos(const Lanes& angle, Lanes& s, Lanes& c, SinCosAccuracy accuracy) {
+        if (accuracy == SinCosAccuracy::Precise) {
+            simd::sincos<SinCosAccuracy::Precise>(angle, s, c);
+        } else {
+            simd::sincos<SinCosAccuracy::Fast>(angle, s, c);
+        }
+    }
+
+}// namespace
+
+void FKPlan::evaluateBatch(std::span<const float> values, std::span<Matrix4> result, bool normalized, SinCosAccuracy accuracy) const {
+
+    const size_t count = result.size();
+    if (count == 0) return;
+    checkNumValues(values.size() / count);
+
+    const auto zero = Lanes::broadcast(0);
+    const auto one = Lanes::broadcast(1);
+
+    for (size_t offset = 0; offset < count; offset += Lanes::size) {
+
+        const size_t remaining = count - offset;
+
+        LaneTransform tf;
+        size_t joint = 0;
+        for (const auto& step : steps_) {
+
+            if (step.type != StepType::Fixed) {
+                auto value = loadJointValues(values.data() + joint++ * count + offset, remaining);
+                if (normalized) {
+                    const auto lower = Lanes::broadcast(step.lower);
+                    value = fma(clamp(value, zero, one), Lanes::broadcast(step.upper - step.lower), lower);
+                }
+
+                const Vector3& a = step.axis;
+                if (step.type == StepType::Prismatic) {
+                    if (step.principalAxis >= 0) {
+                        const auto d = value * Lanes::broadcast(step.principalAxisSign);
+                        for (int i = 0; i < 3; ++i) {
+                            tf.t[i] = fma(tf.r[i][step.principalAxis], d, tf.t[i]);
+                        }
+                    } else {
+                        tf.translate(value * Lanes::broadcast(a.x), value * Lanes::broadcast(a.y), value * Lanes::broadcast(a.z));
+                    }
+                } else {
+                    Lanes s, c;
+                    sinCos(value * Lanes::broadcast(DEG2RAD), s, c, accuracy);
+
+                    if (step.principalAxis >= 0) {
+                        tf.rotatePrincipal(step.principalAxis, c, s * Lanes::broadcast(step.principalAxisSign));
+                    } else {
+                        const auto t = one - c;
+
+                        // Rodrigues, same layout as Matrix4::makeRotationAxis
+                        const auto x = Lanes::broadcast(a.x), y = Lanes::broadcast(a.y), z = Lanes::broadcast(a.z);
+                        const auto tx = t * x, ty = t * y;
+                        const Lanes m[3][3] = {
+                                {fma(tx, x, c), tx * y - s * z, fma(tx, z, s * y)},
+                                {fma(tx, y, s * z), fma(ty, y, c), ty * z - s * x},
+                                {tx * z - s * y, fma(ty, z, s * x), fma(t * z, z, c)}};
+                        tf.rotate(m);
+                    }
+                }
+            }
+
+            if (step.hasTransform) {
+                const auto& te = step.transform.elements;
+                const float m[3][3] = {{te[0], te[3], te[6]}, {te[1], te[4], te[7]}, {te[2], te[5], te[8]}};
+                tf.translate(Lanes::broadcast(te[9]), Lanes::broadcast(te[10]), Lanes::broadcast(te[11]));
+                tf.rotate(m);
+            }
+        }
+
+        alignas(32) float out[12][Lanes::size];
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                tf.r[i][j].store(out[j * 3 + i]);
+            }
+            tf.t[i].store(out[9 + i]);
+        }
+
+        const size_t n = std::min<size_t>(remaining, Lanes::size);
+        for (size_t k = 0; k < n; ++k) {
+            auto& te = result[offset + k].elements;
+            te = {out[0][k], out[1][k], out[2][k], 0,
+                  out[3][k], out[4][k], out[5][k], 0,
+                  out[6][k], out[7][k], out[8][k], 0,
+                  out[9][k], out[10][k], out[11][k], 1};
+        }
+    }
+}
+
+void FKPlan::evaluateRotations(std::span<const float> values, std::span<float> sines, std::span<float> cosines, bool normalized, SinCosAccuracy accuracy) const {
+
+    if (numDof_ == 0) return;
+    const size_t count = values.size() / numDof_;
+    if (sines.size() < numDof_ * count || cosines.size() < numDof_ * count) {
+        throw std::out_of_range("Output spans must hold at least " + std::to_string(numDof_ * count) + " elements");
+    }
+
+    const auto zero = Lanes::broadcast(0);
+    const auto one = Lanes::broadcast(1);
+
+    for (size_t joint = 0; joint < numDof_; ++joint) {
+
+        const auto& step = steps_[jointSteps_[joint]];
+        const size_t row = joint * count;
+
+        if (step.type != StepType::Revolute) {
+            std::fill_n(sines.begin() + row, count, 0.f);
+            std::fill_n(cosines.begin() + row, count, 1.f);
+            continue;
+        }
+
+        const auto lower = Lanes::broadcast(step.lower);
+        const auto range = Lanes::broadcast(step.upper - step.lower);
+        for (size_t offset = 0; offset < count; offset += Lanes::size) {
+
+            const size_t remaining = count - offset;
+
+            auto value = loadJointValues(values.data() + row + offset, remaining);
+            if (normalized) {
+                value = fma(clamp(value, zero, one), range, lower);
+            }
+
+            Lanes s, c;
+            sinCos(value * Lanes::broadcast(DEG2RAD), s, c, accuracy);
+
+            if (remaining >= Lanes::size) {
+                s.store(sines.data() + row + offset);
+                c.store(cosines.data() + row + offset);
+            } else {
+                float tmp[Lanes::size];
+                s.store(tmp);
+                std::copy_n(tmp, remaining, sines.begin() + row + offset);
+                c.store(tmp);
+                std::copy_n(tmp, remaining, cosines.begin() + row + offset);
+            }
+        }
+    }
+}
@@ -0,0 +1,138 @@
+
+#include "kine/WorkStealingPool.hpp"
+
+#include <algorithm>
+
+using namespace kine;
+
+WorkStealingPool::WorkStealingPool(unsigned int numThreads) {
+
+    const size_t n = std::max(1u, numThreads);
+    for (size_t i = 0; i < n; ++i) {
+        ranges_.emplace_back(std::make_unique<Range>());
+    }
+    for (size_t i = 1; i < n; ++i) {
+        threads_.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::parallelFor(size_t count, const std::function<void(size_t, size_t)>& task) {
+
+    if (count == 0) return;
+
+    std::lock_guard call(callMutex_);
+
+    // contiguous equal shares, neighbouring indices tend to cost about the same
+    const size_t n = size();
+    for (size_t i = 0; i < n; ++i) {
+        std::lock_guard lock(ranges_[i]->mutex);
+        ranges_[i]->begin = count * i / n;
+        ranges_[i]->end = count * (i + 1) / n;
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        task_ = &task;
+        error_ = nullptr;
+        cancelled_ = false;
+        running_ = n;
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    run(0);
+
+    std::unique_lock lock(mutex_);
+    done_.wait(lock, [this] { return running_ == 0; });
+    task_ = nullptr;
+    if (error_) std::rethrow_exception(error_);
+}
+
+void WorkStealingPool::workerLoop(size_t worker) {
+
+    size_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock lock(mutex_);
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+        }
+        run(worker);
+    }
+}
+
+void WorkStealingPool::run(size_t worker) {
+
+    try {
+        size_t index;
+        while (next(worker, index)) {
+            (*task_)(index, worker);
+        }
+    } catch (...) {
+        std::lock_guard lock(mutex_);
+        if (!error_) error_ = std::current_exception();
+        cancelled_ = true;
+    }
+
+    bool last;
+    {
+        std::lock_guard lock(mutex_);
+        last = --running_ == 0;
+    }
+    if (last) done_.notify_one();
+}
+
+bool WorkStealingPool::next(size_t worker, size_t& index) {
+
+    if (cancelled_) return false;
+
+    auto& own = *ranges_[worker];
+    do {
+        std::lock_guard lock(own.mutex);
+        if (own.begin < own.end) {
+            index = own.begin++;
+            return true;
+        }
+    } while (steal(worker));
+
+    return false;
+}
+
+bool WorkStealingPool::steal(size_t worker) {
+
+    const size_t n = size();
+    for (size_t offset = 1; offset < n; ++offset) {
+
+        auto& victim = *ranges_[(worker + offset) % n];
+        size_t begin, end;
+        {
+            std::lock_guard lock(victim.mutex);
+            if (victim.begin >= victim.end) continue;
+            // the back half, rounded up so a single remaining index can be taken as well
+            begin = victim.begin + (victim.end - victim.begin) / 2;
+            end = victim.end;
+            victim.end = begin;
+        }
+
+        auto& own = *ranges_[worker];
+        std::lock_guard lock(own.mutex);
+        own.begin = begin;
+        own.end = end;
+        return true;
+    }
+
+    return false;
+}
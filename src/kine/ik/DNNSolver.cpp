@@ -3,76 +3,148 @@
 
 #include <onnxruntime_cxx_api.h>
 
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+
 
 using namespace kine;
 
 
 struct DNNSolver::Impl {
 
-    Impl(const std::filesystem::path& model)
+    Impl(const std::filesystem::path& model, size_t maxBatchSize, int intraOpThreads)
         : env_(ORT_LOGGING_LEVEL_WARNING, "ONNX IK"),
-          input_data_(3),
+          memoryInfo_(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)),
+          maxBatchSize_(std::max<size_t>(1, maxBatchSize)),
+          intraOpThreads_(intraOpThreads),
           model_(model) {}
 
-    std::vector<float> solveIK(const Kine& kine, const Vector3& target, const std::vector<float>&) {
+    // Runs the model on count targets, writing count x numDof joint values to output.
+    void run(const Kine& kine, const Vector3* targets, size_t count, float* output) {
 
-        if (!session_) {
-            Ort::SessionOptions session_options;
-            session_options.SetIntraOpNumThreads(1);
-            session_options.SetGraphOptimizationLevel(ORT_ENABLE_EXTENDED);
-            session_ = std::make_unique<Ort::Session>(env_, model_.c_str(), session_options);
-        }
+        init(kine);
 
         const char* input_names[] = {"input"};
         const char* output_names[] = {"output"};
 
-        input_data_[0] = target.x;
-        input_data_[1] = target.y;
-        input_data_[2] = target.z;
+        input_data_.resize(3 * count);
+        for (size_t i = 0; i < count; i++) {
+            input_data_[3 * i] = targets[i].x;
+            input_data_[3 * i + 1] = targets[i].y;
+            input_data_[3 * i + 2] = targets[i].z;
+        }
+
+        const int64_t numDof = static_cast<int64_t>(kine.numDof());
+        const std::array<int64_t, 2> input_dims = {static_cast<int64_t>(count), 3};
+        const std::array<int64_t, 2> output_dims = {static_cast<int64_t>(count), numDof};
 
-        // Input tensor
-        std::vector<int64_t> input_dims = {1, 3};// Batch size 1, 3 features
         Ort::Value input_tensor = Ort::Value::CreateTensor<float>(
-                Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault),
-                input_data_.data(), input_data_.size(), input_dims.data(), input_dims.size());
+                memoryInfo_, input_data_.data(), input_data_.size(), input_dims.data(), input_dims.size());
 
-        // Run inference
-        auto output_tensors = session_->Run(
+        // the output is bound to the caller's memory, so no copy is needed afterwards
+        Ort::Value output_tensor = Ort::Value::CreateTensor<float>(
+                memoryInfo_, output, count * kine.numDof(), output_dims.data(), output_dims.size());
+
+        session_->Run(
                 Ort::RunOptions{nullptr},// Run options
                 input_names,             // Input names
                 &input_tensor,           // Input tensors
                 1,                       // Input count
                 output_names,            // Output names
+                &output_tensor,          // Output tensors
                 1                        // Output count
         );
+    }
 
-        // Process output
-        const auto* output_data = output_tensors[0].GetTensorMutableData<float>();
-
-        // Convert the data to a vector
-        std::vector<float> output_vector(kine.numDof());
-        for (size_t i = 0; i < kine.numDof(); i++) {
-            output_vector[i] = output_data[i];
-        }
+    // Number of targets that go into one inference.
+    [[nodiscard]] size_t batchSize(const Kine& kine) {
 
-        return output_vector;
+        init(kine);
+        return batched_ ? maxBatchSize_ : 1;
     }
 
 private:
     Ort::Env env_;
+    Ort::MemoryInfo memoryInfo_;
     std::vector<float> input_data_;
     std::unique_ptr<Ort::Session> session_;
+    // whether the model takes a dynamic batch dimension
+    bool batched_{false};
+    // joint values predicted per target, negative if the model leaves it open
+    int64_t outputWidth_{-1};
 
+    size_t maxBatchSize_;
+    int intraOpThreads_;
     std::filesystem::path model_;
+
+    void init(const Kine& kine) {
+
+        if (!session_) {
+            Ort::SessionOptions session_options;
+            session_options.SetIntraOpNumThreads(intraOpThreads_);
+            session_options.SetGraphOptimizationLevel(ORT_ENABLE_EXTENDED);
+            session_ = std::make_unique<Ort::Session>(env_, model_.c_str(), session_options);
+
+            const auto input_shape = session_->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+            batched_ = !input_shape.empty() && input_shape[0] < 0;
+            const auto output_shape = session_->GetOutputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+            if (!output_shape.empty()) outputWidth_ = output_shape.back();
+        }
+
+        if (outputWidth_ > 0 && static_cast<size_t>(outputWidth_) != kine.numDof()) {
+            throw std::invalid_argument("Model predicts " + std::to_string(outputWidth_) + " joint values, the chain has " + std::to_string(kine.numDof()));
+        }
+    }
 };
 
-DNNSolver::DNNSolver(const std::filesystem::path& model)
-    : pimpl_(std::make_unique<Impl>(model)) {
+DNNSolver::DNNSolver(const std::filesystem::path& model, size_t maxBatchSize, int intraOpThreads)
+    : pimpl_(std::make_unique<Impl>(model, maxBatchSize, intraOpThreads)) {
 }
 
 std::vector<float> DNNSolver::solveIK(const Kine& kine, const Vector3& target, const std::vector<float>& startValues) {
 
-    return pimpl_->solveIK(kine, target, startValues);
+    return solveIKDetailed(kine, target, startValues).values;
+}
+
+IKResult DNNSolver::solveIKDetailed(const Kine& kine, const Vector3& target, const std::vector<float>&) {
+
+    beginSolve();
+    std::vector<float> values(kine.numDof());
+    pimpl_->run(kine, &target, 1, values.data());
+
+    // a single inference, no iterations to count
+    RigidTransform t;
+    kine.plan().evaluate(values, false, t);
+    ++fkEvaluations_;
+    residual_ = t.getPosition().distanceTo(target);
+    converged_ = residual_ < eps_;
+
+    return {endSolve(), std::move(values)};
+}
+
+void DNNSolver::solveBatch(const Kine& kine, std::span<const Vector3> targets, std::span<float> results, std::span<float> residuals) {
+
+    const size_t numDof = kine.numDof();
+    const size_t count = targets.size();
+    if (results.size() < count * numDof || (!residuals.empty() && residuals.size() < count)) {
+        throw std::out_of_range("Output spans must hold " + std::to_string(count * numDof) + " values and " + std::to_string(count) + " residuals");
+    }
+
+    const size_t batchSize = pimpl_->batchSize(kine);
+    for (size_t offset = 0; offset < count; offset += batchSize) {
+        const size_t n = std::min(batchSize, count - offset);
+        pimpl_->run(kine, targets.data() + offset, n, results.data() + offset * numDof);
+    }
+
+    if (!residuals.empty()) {
+        RigidTransform t;
+        for (size_t i = 0; i < count; i++) {
+            kine.plan().evaluate(results.subspan(i * numDof, numDof), false, t);
+            residuals[i] = t.getPosition().distanceTo(targets[i]);
+        }
+    }
 }
 
 DNNSolver::~DNNSolver() = default;
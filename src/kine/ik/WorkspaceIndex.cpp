@@ -0,0 +1,284 @@
+
+#include "kine/ik/WorkspaceIndex.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define KINE_WORKSPACEINDEX_MMAP
+#endif
+
+using namespace kine;
+
+namespace {
+
+    constexpr std::array<char, 8> magic{'K', 'I', 'N', 'E', 'W', 'S', 'I', 0};
+    constexpr uint32_t version = 1;
+
+    // Followed by the points (x, y, z per sample) and the configurations (numDof values per sample) in tree order.
+    struct FileHeader {
+        std::array<char, 8> magic;
+        uint32_t version;
+        uint32_t numDof;
+        uint64_t size;
+        uint64_t fingerprint;
+        uint64_t reserved[4];
+    };
+    static_assert(sizeof(FileHeader) == 64);
+
+    // FNV-1a over the plan, so an index is only loaded for the chain it was built for.
+    uint64_t fingerprint(const Kine& kine) {
+
+        uint64_t hash = 14695981039346656037ull;
+        const auto add = [&](const void* data, size_t size) {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        };
+
+        for (const auto& step : kine.plan().steps()) {
+            const auto type = static_cast<int>(step.type);
+            add(&type, sizeof(type));
+            if (step.type != FKPlan::StepType::Fixed) {
+                add(&step.axis.x, sizeof(float));
+                add(&step.axis.y, sizeof(float));
+                add(&step.axis.z, sizeof(float));
+                add(&step.lower, sizeof(float));
+                add(&step.upper, sizeof(float));
+            }
+            if (step.hasTransform) {
+                add(step.transform.elements.data(), step.transform.elements.size() * sizeof(float));
+            }
+        }
+
+        return hash;
+    }
+
+    float coordinate(const float* points, size_t i, int axis) {
+        return points[3 * i + axis];
+    }
+
+    // Orders order[lo, hi) so that the median along the axis of this depth sits at the middle, recursively.
+    void buildTree(const float* points, std::span<uint32_t> order, size_t lo, size_t hi, int depth) {
+
+        if (hi - lo < 2) return;
+
+        const size_t mid = lo + (hi - lo) / 2;
+        const int axis = depth % 3;
+        std::nth_element(order.begin() + lo, order.begin() + mid, order.begin() + hi, [&](uint32_t a, uint32_t b) {
+            return coordinate(points, a, axis) < coordinate(points, b, axis);
+        });
+
+        buildTree(points, order, lo, mid, depth + 1);
+        buildTree(points, order, mid + 1, hi, depth + 1);
+    }
+
+    struct Search {
+        const float* points;
+        float target[3];
+        size_t best;
+        float bestDistance;
+
+        void run(size_t lo, size_t hi, int depth) {
+
+            if (lo >= hi) return;
+
+            const size_t mid = lo + (hi - lo) / 2;
+            const float* p = points + 3 * mid;
+            const float dx = target[0] - p[0], dy = target[1] - p[1], dz = target[2] - p[2];
+            const float distance = dx * dx + dy * dy + dz * dz;
+            if (distance < bestDistance) {
+                best = mid;
+                bestDistance = distance;
+            }
+
+            // the side containing the target first, the other only if the splitting plane is closer than the best so far
+            const float diff = target[depth % 3] - p[depth % 3];
+            if (diff < 0) {
+                run(lo, mid, depth + 1);
+                if (diff * diff < bestDistance) run(mid + 1, hi, depth + 1);
+            } else {
+                run(mid + 1, hi, depth + 1);
+                if (diff * diff < bestDistance) run(lo, mid, depth + 1);
+            }
+        }
+    };
+
+}// namespace
+
+WorkspaceIndex WorkspaceIndex::build(const Kine& kine, size_t numSamples, unsigned int seed) {
+
+    const size_t numDof = kine.numDof();
+    if (numSamples > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("At most 2^32 - 1 samples are supported");
+    }
+
+    std::vector<std::uniform_real_distribution<float>> distributions;
+    const auto& plan = kine.plan();
+    for (size_t j = 0; j < numDof; ++j) {
+        const auto& limit = kine.joints()[j]->limit();
+        const bool revolute = plan.steps()[plan.jointStep(j)].type == FKPlan::StepType::Revolute;
+        if (!revolute && (!limit.min() || !limit.max())) {
+            throw std::invalid_argument("Prismatic joint " + std::to_string(j) + " needs limits to be sampled");
+        }
+        // a revolute joint open on one side covers a full turn from its bound
+        const float lower = limit.min().value_or(limit.max() ? *limit.max() - 360.f : -180.f);
+        const float upper = limit.max().value_or(limit.min() ? *limit.min() + 360.f : 180.f);
+        if (lower > upper) {
+            throw std::invalid_argument("Joint " + std::to_string(j) + " has a lower limit above its upper limit");
+        }
+        distributions.emplace_back(lower, upper);
+    }
+
+    std::vector<float> points(3 * numSamples);
+    std::vector<float> configurations(numDof * numSamples);
+
+    // sample and evaluate in chunks, the batch FK takes joint-major values
+    constexpr size_t chunk = 4096;
+    std::mt19937 gen(seed);
+    std::vector<float> values(numDof * chunk);
+    std::vector<Matrix4> transforms(chunk);
+    for (size_t offset = 0; offset < numSamples; offset += chunk) {
+
+        const size_t n = std::min(chunk, numSamples - offset);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < numDof; ++j) {
+                const float v = distributions[j](gen);
+                values[j * n + i] = v;
+                configurations[(offset + i) * numDof + j] = v;
+            }
+        }
+
+        plan.evaluateBatch(std::span(values).first(numDof * n), std::span(transforms).first(n), false);
+        for (size_t i = 0; i < n; ++i) {
+            const auto& te = transforms[i].elements;
+            std::copy_n(te.begin() + 12, 3, points.begin() + 3 * (offset + i));
+        }
+    }
+
+    std::vector<uint32_t> order(numSamples);
+    std::iota(order.begin(), order.end(), 0u);
+    buildTree(points.data(), order, 0, numSamples, 0);
+
+    WorkspaceIndex index;
+    index.size_ = numSamples;
+    index.numDof_ = numDof;
+    index.fingerprint_ = fingerprint(kine);
+    const auto storage = std::make_shared<float[]>((3 + numDof) * numSamples);
+    float* sortedPoints = storage.get();
+    float* sortedConfigurations = sortedPoints + 3 * numSamples;
+    for (size_t i = 0; i < numSamples; ++i) {
+        std::copy_n(points.begin() + 3 * order[i], 3, sortedPoints + 3 * i);
+        std::copy_n(configurations.begin() + numDof * order[i], numDof, sortedConfigurations + numDof * i);
+    }
+    index.storage_ = storage;
+    index.points_ = sortedPoints;
+    index.configurations_ = sortedConfigurations;
+
+    return index;
+}
+
+WorkspaceIndex WorkspaceIndex::load(const std::filesystem::path& path, const Kine& kine) {
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error("Unable to open " + path.string());
+
+    FileHeader header{};
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != magic) {
+        throw std::runtime_error(path.string() + " is not a workspace index");
+    }
+    if (header.version != version) {
+        throw std::runtime_error(path.string() + " has unsupported version " + std::to_string(header.version));
+    }
+    if (header.numDof != kine.numDof() || header.fingerprint != fingerprint(kine)) {
+        throw std::runtime_error(path.string() + " was built for a different chain");
+    }
+
+    const size_t dataSize = (3 + header.numDof) * header.size * sizeof(float);
+    const size_t fileSize = sizeof(FileHeader) + dataSize;
+    if (std::filesystem::file_size(path) != fileSize) {
+        throw std::runtime_error(path.string() + " is truncated");
+    }
+
+    WorkspaceIndex index;
+    index.size_ = header.size;
+    index.numDof_ = header.numDof;
+    index.fingerprint_ = header.fingerprint;
+
+#ifdef KINE_WORKSPACEINDEX_MMAP
+    in.close();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Unable to open " + path.string());
+    void* address = ::mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) throw std::runtime_error("Unable to map " + path.string());
+
+    index.storage_ = std::shared_ptr<const void>(address, [fileSize](const void* p) {
+        ::munmap(const_cast<void*>(p), fileSize);
+    });
+    const auto* data = reinterpret_cast<const float*>(static_cast<const char*>(address) + sizeof(FileHeader));
+#else
+    // no mmap, read the data instead
+    const auto storage = std::make_shared<float[]>((3 + header.numDof) * header.size);
+    if (!in.read(reinterpret_cast<char*>(storage.get()), static_cast<std::streamsize>(dataSize))) {
+        throw std::runtime_error("Unable to read " + path.string());
+    }
+    index.storage_ = storage;
+    const float* data = storage.get();
+#endif
+
+    index.points_ = data;
+    index.configurations_ = data + 3 * header.size;
+
+    return index;
+}
+
+void WorkspaceIndex::save(const std::filesystem::path& path) const {
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out) throw std::runtime_error("Unable to open " + path.string() + " for writing");
+
+    FileHeader header{};
+    header.magic = magic;
+    header.version = version;
+    header.numDof = static_cast<uint32_t>(numDof_);
+    header.size = size_;
+    header.fingerprint = fingerprint_;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(points_), static_cast<std::streamsize>(3 * size_ * sizeof(float)));
+    out.write(reinterpret_cast<const char*>(configurations_), static_cast<std::streamsize>(numDof_ * size_ * sizeof(float)));
+    if (!out) throw std::runtime_error("Unable to write " + path.string());
+}
+
+size_t WorkspaceIndex::nearest(const Vector3& target) const {
+
+    if (size_ == 0) throw std::out_of_range("The index is empty");
+
+    Search search{points_, {target.x, target.y, target.z}, 0, std::numeric_limits<float>::max()};
+    search.run(0, size_, 0);
+    return search.best;
+}
+
+float WorkspaceIndex::seed(const Vector3& target, std::span<float> seed) const {
+
+    if (seed.size() < numDof_) {
+        throw std::out_of_range("Seed must hold at least " + std::to_string(numDof_) + " values");
+    }
+
+    const size_t i = nearest(target);
+    const auto values = configuration(i);
+    std::copy(values.begin(), values.end(), seed.begin());
+    return position(i).distanceTo(target);
+}
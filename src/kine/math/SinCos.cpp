@@ -0,0 +1,53 @@
+
+#include "kine/math/SinCos.hpp"
+
+#include "kine/simd/SinCos.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+using namespace kine;
+using simd::Lanes;
+
+namespace {
+
+    template<SinCosAccuracy accuracy>
+    void sincosImpl(std::span<const float> angles, std::span<float> sines, std::span<float> cosines) {
+
+        const size_t n = angles.size();
+
+        size_t i = 0;
+        Lanes s, c;
+        for (; i + Lanes::size <= n; i += Lanes::size) {
+            simd::sincos<accuracy>(Lanes::load(angles.data() + i), s, c);
+            s.store(sines.data() + i);
+            c.store(cosines.data() + i);
+        }
+
+        if (i < n) {
+            float tmp[Lanes::size]{};
+            std::copy(angles.begin() + i, angles.end(), tmp);
+            simd::sincos<accuracy>(Lanes::load(tmp), s, c);
+
+            s.store(tmp);
+            std::copy_n(tmp, n - i, sines.begin() + i);
+            c.store(tmp);
+            std::copy_n(tmp, n - i, cosines.begin() + i);
+        }
+    }
+
+}// namespace
+
+void kine::sincos(std::span<const float> angles, std::span<float> sines, std::span<float> cosines, SinCosAccuracy accuracy) {
+
+    if (sines.size() < angles.size() || cosines.size() < angles.size()) {
+        throw std::out_of_range("Output spans must hold at least " + std::to_string(angles.size()) + " elements");
+    }
+
+    if (accuracy == SinCosAccuracy::Precise) {
+        sincosImpl<SinCosAccuracy::Precise>(angles, sines, cosines);
+    } else {
+        sincosImpl<SinCosAccuracy::Fast>(angles, sines, cosines);
+    }
+}
@@ -0,0 +1,111 @@
+
+#ifndef KINE_LANES_HPP
+#define KINE_LANES_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define KINE_LANES_SSE
+#endif
+
+namespace kine::simd {
+
+    // A group of 8 floats processed in lock-step.
+    // Maps to one AVX register, two SSE registers or a plain array depending on the target.
+    struct Lanes {
+
+        static constexpr int size = 8;
+
+#if defined(__AVX__)
+        __m256 v;
+
+        static Lanes load(const float* p) { return {_mm256_loadu_ps(p)}; }
+        static Lanes broadcast(float s) { return {_mm256_set1_ps(s)}; }
+        void store(float* p) const { _mm256_storeu_ps(p, v); }
+
+        friend Lanes operator+(Lanes a, Lanes b) { return {_mm256_add_ps(a.v, b.v)}; }
+        friend Lanes operator-(Lanes a, Lanes b) { return {_mm256_sub_ps(a.v, b.v)}; }
+        friend Lanes operator*(Lanes a, Lanes b) { return {_mm256_mul_ps(a.v, b.v)}; }
+        friend Lanes min(Lanes a, Lanes b) { return {_mm256_min_ps(a.v, b.v)}; }
+        friend Lanes max(Lanes a, Lanes b) { return {_mm256_max_ps(a.v, b.v)}; }
+        friend Lanes round(Lanes a) { return {_mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)}; }
+        friend Lanes floor(Lanes a) { return {_mm256_floor_ps(a.v)}; }
+
+        // a * b + c
+        friend Lanes fma(Lanes a, Lanes b, Lanes c) {
+#if defined(__FMA__)
+            return {_mm256_fmadd_ps(a.v, b.v, c.v)};
+#else
+            return a * b + c;
+#endif
+        }
+#elif defined(KINE_LANES_SSE)
+        __m128 lo, hi;
+
+        static Lanes load(const float* p) { return {_mm_loadu_ps(p), _mm_loadu_ps(p + 4)}; }
+        static Lanes broadcast(float s) { return {_mm_set1_ps(s), _mm_set1_ps(s)}; }
+        void store(float* p) const {
+            _mm_storeu_ps(p, lo);
+            _mm_storeu_ps(p + 4, hi);
+        }
+
+        friend Lanes operator+(Lanes a, Lanes b) { return {_mm_add_ps(a.lo, b.lo), _mm_add_ps(a.hi, b.hi)}; }
+        friend Lanes operator-(Lanes a, Lanes b) { return {_mm_sub_ps(a.lo, b.lo), _mm_sub_ps(a.hi, b.hi)}; }
+        friend Lanes operator*(Lanes a, Lanes b) { return {_mm_mul_ps(a.lo, b.lo), _mm_mul_ps(a.hi, b.hi)}; }
+        friend Lanes min(Lanes a, Lanes b) { return {_mm_min_ps(a.lo, b.lo), _mm_min_ps(a.hi, b.hi)}; }
+        friend Lanes max(Lanes a, Lanes b) { return {_mm_max_ps(a.lo, b.lo), _mm_max_ps(a.hi, b.hi)}; }
+        // SSE2 has no rounding instructions, round trip through int32 instead (valid for |a| < 2^31)
+        friend Lanes round(Lanes a) { return {_mm_cvtepi32_ps(_mm_cvtps_epi32(a.lo)), _mm_cvtepi32_ps(_mm_cvtps_epi32(a.hi))}; }
+        friend Lanes floor(Lanes a) {
+            const Lanes r = round(a);
+            const __m128 one = _mm_set1_ps(1);
+            return {_mm_sub_ps(r.lo, _mm_and_ps(_mm_cmpgt_ps(r.lo, a.lo), one)), _mm_sub_ps(r.hi, _mm_and_ps(_mm_cmpgt_ps(r.hi, a.hi), one))};
+        }
+
+        // a * b + c
+        friend Lanes fma(Lanes a, Lanes b, Lanes c) { return a * b + c; }
+#else
+        std::array<float, size> v;
+
+        static Lanes load(const float* p) {
+            Lanes l;
+            std::copy(p, p + size, l.v.begin());
+            return l;
+        }
+        static Lanes broadcast(float s) {
+            Lanes l;
+            l.v.fill(s);
+            return l;
+        }
+        void store(float* p) const { std::copy(v.begin(), v.end(), p); }
+
+        template<class Op>
+        static Lanes apply(const Lanes& a, const Lanes& b, Op op) {
+            Lanes l;
+            for (int i = 0; i < size; ++i) l.v[i] = op(a.v[i], b.v[i]);
+            return l;
+        }
+
+        friend Lanes operator+(Lanes a, Lanes b) { return apply(a, b, [](float x, float y) { return x + y; }); }
+        friend Lanes operator-(Lanes a, Lanes b) { return apply(a, b, [](float x, float y) { return x - y; }); }
+        friend Lanes operator*(Lanes a, Lanes b) { return apply(a, b, [](float x, float y) { return x * y; }); }
+        friend Lanes min(Lanes a, Lanes b) { return apply(a, b, [](float x, float y) { return std::min(x, y); }); }
+        friend Lanes max(Lanes a, Lanes b) { return apply(a, b, [](float x, float y) { return std::max(x, y); }); }
+        friend Lanes round(Lanes a) { return apply(a, a, [](float x, float) { return std::nearbyint(x); }); }
+        friend Lanes floor(Lanes a) { return apply(a, a, [](float x, float) { return std::floor(x); }); }
+
+        // a * b + c
+        friend Lanes fma(Lanes a, Lanes b, Lanes c) { return a * b + c; }
+#endif
+
+        friend Lanes clamp(Lanes x, Lanes lo, Lanes hi) { return min(max(x, lo), hi); }
+    };
+
+}// namespace kine::simd
+
+#endif//KINE_LANES_HPP
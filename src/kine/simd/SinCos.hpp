@@ -0,0 +1,74 @@
+
+#ifndef KINE_SIMD_SINCOS_HPP
+#define KINE_SIMD_SINCOS_HPP
+
+#include "kine/math/SinCos.hpp"
+#include "kine/simd/Lanes.hpp"
+
+namespace kine::simd {
+
+    // Sine and cosine of 8 angles at once.
+    // The angle is reduced to r in [-pi/4, pi/4] around the nearest multiple q of pi/2 (Cody-Waite),
+    // after which sin(r) and cos(r) are approximated by polynomials and swapped/negated according to q mod 4.
+    template<SinCosAccuracy accuracy>
+    inline void sincos(const Lanes& x, Lanes& sin, Lanes& cos) {
+
+        const auto one = Lanes::broadcast(1);
+        const auto half = Lanes::broadcast(0.5f);
+
+        const auto q = round(x * Lanes::broadcast(0.636619772367581343f));// 2 / pi
+
+        // pi / 2 split into parts that are exact when multiplied by q
+        Lanes r;
+        if constexpr (accuracy == SinCosAccuracy::Precise) {
+            r = fma(q, Lanes::broadcast(-1.5703125f), x);
+            r = fma(q, Lanes::broadcast(-4.837512969970703125e-4f), r);
+            r = fma(q, Lanes::broadcast(-7.54978995489188216e-8f), r);
+        } else {
+            r = fma(q, Lanes::broadcast(-1.5703125f), x);
+            r = fma(q, Lanes::broadcast(-4.8382673412561417e-4f), r);
+        }
+
+        const auto r2 = r * r;
+        Lanes s, c;
+        if constexpr (accuracy == SinCosAccuracy::Precise) {
+            // Cephes sinf/cosf coefficients
+            s = fma(Lanes::broadcast(-1.9515295891e-4f), r2, Lanes::broadcast(8.3321608736e-3f));
+            s = fma(s, r2, Lanes::broadcast(-1.6666654611e-1f));
+            s = fma(s * r2, r, r);
+
+            c = fma(Lanes::broadcast(2.443315711809948e-5f), r2, Lanes::broadcast(-1.388731625493765e-3f));
+            c = fma(c, r2, Lanes::broadcast(4.166664568298827e-2f));
+            c = fma(c * r2, r2, one - half * r2);
+        } else {
+            // least-squares fit on [0, pi/4]
+            s = fma(Lanes::broadcast(8.153119491384263e-3f), r2, Lanes::broadcast(-1.6662840174403074e-1f));
+            s = fma(s * r2, r, r);
+
+            c = fma(Lanes::broadcast(4.049818286841634e-2f), r2, Lanes::broadcast(-4.9978117793480337e-1f));
+            c = fma(c, r2, one);
+        }
+
+        // quadrant = q mod 4, split into its two bits
+        const auto quadrant = q - Lanes::broadcast(4) * floor(q * Lanes::broadcast(0.25f));
+        const auto high = floor(quadrant * half);
+        const auto odd = quadrant - (high + high);
+
+        // odd quadrants swap sine and cosine, the blend is exact since odd is either 0 or 1
+        const auto even = one - odd;
+        const auto swappedSin = s * even + c * odd;
+        const auto swappedCos = c * even + s * odd;
+
+        // sine is negative in quadrants 2 and 3, cosine in quadrants 1 and 2
+        const auto two = Lanes::broadcast(2);
+        const auto sinSign = one - two * high;
+        const auto cosFlip = odd + high - two * odd * high;
+        const auto cosSign = one - two * cosFlip;
+
+        sin = swappedSin * sinSign;
+        cos = swappedCos * cosSign;
+    }
+
+}// namespace kine::simd
+
+#endif//KINE_SIMD_SINCOS_HPP
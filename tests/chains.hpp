@@ -0,0 +1,71 @@
+
+#ifndef KINE_TESTS_CHAINS_HPP
+#define KINE_TESTS_CHAINS_HPP
+
+#include "kine/Kine.hpp"
+#include "kine/ik/IKSolver.hpp"
+
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// Chains and helpers shared by the tests.
+namespace kine::test {
+
+    // The crane of the Crane3R example.
+    inline Kine crane3R() {
+
+        return KineBuilder()
+                .addRevoluteJoint(Vector3::Y(), {-90.f, 90.f})
+                .addLink(Vector3::Y() * 4.2)
+                .addRevoluteJoint(Vector3::X(), {-80.f, 0.f})
+                .addLink(Vector3::Z() * 7)
+                .addRevoluteJoint(Vector3::X(), {40.f, 140.f})
+                .addLink(Vector3::Z() * 5.2)
+                .build();
+    }
+
+    // A base joint followed by six alternating hinges, redundant for position targets.
+    inline Kine sevenDofChain() {
+
+        KineBuilder builder;
+        builder.addRevoluteJoint(Vector3::Y(), {-180.f, 180.f}).addLink(Vector3::Y());
+        for (int i = 0; i < 6; ++i) {
+            builder.addRevoluteJoint(i % 2 ? Vector3::X() : Vector3::Z(), {-90.f, 90.f}).addLink(Vector3::Y() * 0.6f);
+        }
+        return builder.build();
+    }
+
+    // End-effector positions of random configurations away from the joint limits.
+    inline std::vector<Vector3> reachableTargets(const Kine& kine, size_t count, unsigned int seed = 1) {
+
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<float> dist(0.05f, 0.95f);
+
+        std::vector<Vector3> targets(count);
+        std::vector<float> values(kine.numDof());
+        for (auto& t : targets) {
+            for (auto& v : values) v = dist(gen);
+            t.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values, true));
+        }
+        return targets;
+    }
+
+    // Throws for targets with x above maxX, returns the start values for the others.
+    struct ThrowingSolver: IKSolver {
+
+        float maxX;
+
+        explicit ThrowingSolver(float maxX = -std::numeric_limits<float>::infinity())
+            : maxX(maxX) {}
+
+        std::vector<float> solveIK(const Kine&, const Vector3& target, const std::vector<float>& startValues) override {
+            if (target.x > maxX) throw std::runtime_error("unsupported target");
+            return startValues;
+        }
+    };
+
+}// namespace kine::test
+
+#endif//KINE_TESTS_CHAINS_HPP
@@ -0,0 +1,177 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/ik/AnalyticalSolver.hpp"
+
+#include "chains.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    // Unlimited arm with link offsets and an elbow axis flipped against the shoulder,
+    // both elbow branches exist for either base angle unless the flipped one puts the target out of reach.
+    Kine offsetArm() {
+
+        return KineBuilder()
+                .addRevoluteJoint(Vector3::Y(), {-180.f, 180.f})
+                .addLink({0.3f, 1.f, 0.2f})
+                .addRevoluteJoint(Vector3::X(), {-180.f, 180.f})
+                .addLink({0.f, 0.3f, 2.f})
+                .addRevoluteJoint(Vector3::X() * -1, {-180.f, 180.f})
+                .addLink(Vector3::Z() * 1.5f)
+                .build();
+    }
+
+    float distanceToTarget(const Kine& kine, const std::vector<float>& values, const Vector3& target) {
+
+        Vector3 reached;
+        reached.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values));
+        return reached.distanceTo(target);
+    }
+
+    void checkWithinLimits(const Kine& kine, const std::vector<float>& values) {
+
+        for (size_t i = 0; i < kine.numDof(); ++i) {
+            const auto& limit = kine.joints()[i]->limit();
+            CHECK(values[i] >= *limit.min());
+            CHECK(values[i] <= *limit.max());
+        }
+    }
+
+}// namespace
+
+TEST_CASE("Every branch of solveAll reaches the target") {
+
+    SECTION("crane") {
+        const auto kine = crane3R();
+        for (const auto& target : reachableTargets(kine, 100)) {
+            const auto solutions = AnalyticalSolver::solveAll(kine, target);
+            REQUIRE_FALSE(solutions.empty());
+            for (const auto& s : solutions) {
+                const std::vector<float> values(s.begin(), s.end());
+                CHECK(distanceToTarget(kine, values, target) < 1e-3f);
+                checkWithinLimits(kine, values);
+            }
+        }
+    }
+
+    SECTION("offset arm") {
+        const auto kine = offsetArm();
+        for (const auto& target : reachableTargets(kine, 100)) {
+            const auto solutions = AnalyticalSolver::solveAll(kine, target);
+            CHECK((solutions.size() == 2 || solutions.size() == 4));
+            for (const auto& s : solutions) {
+                CHECK(distanceToTarget(kine, {s.begin(), s.end()}, target) < 1e-3f);
+            }
+        }
+    }
+}
+
+TEST_CASE("solveIK picks the branch closest to the start values") {
+
+    const auto kine = offsetArm();
+    AnalyticalSolver solver;
+
+    for (const auto& target : reachableTargets(kine, 20)) {
+        const auto solutions = AnalyticalSolver::solveAll(kine, target);
+        REQUIRE(solutions.size() >= 2);
+
+        for (const auto& s : solutions) {
+            // starting next to a branch ends up on the nearest one, usually that branch itself
+            const std::vector<float> start{s[0] + 5, s[1] - 5, s[2] + 5};
+            const auto distance = [&](const AnalyticalSolver::Solution& other) {
+                float sum = 0;
+                for (size_t i = 0; i < 3; ++i) sum += (other[i] - start[i]) * (other[i] - start[i]);
+                return sum;
+            };
+            const auto& nearest = *std::min_element(solutions.begin(), solutions.end(), [&](const auto& a, const auto& b) {
+                return distance(a) < distance(b);
+            });
+
+            const auto result = solver.solveIKDetailed(kine, target, start);
+            CHECK(result.converged());
+            CHECK(result.iterations == 0);
+            for (size_t i = 0; i < 3; ++i) {
+                CHECK_THAT(result.values[i], WithinAbs(nearest[i], 1e-3));
+            }
+        }
+    }
+}
+
+TEST_CASE("Out of reach targets fall back to the closest clamped branch") {
+
+    AnalyticalSolver solver;
+
+    SECTION("stretched towards the target") {
+        const auto kine = offsetArm();
+        const Vector3 target(0.3f, 1, 20);
+        REQUIRE(AnalyticalSolver::solveAll(kine, target).empty());
+
+        const auto result = solver.solveIKDetailed(kine, target, kine.meanAngles());
+        CHECK_FALSE(result.converged());
+        CHECK_THAT(result.residual, WithinAbs(distanceToTarget(kine, result.values, target), 1e-4));
+
+        // the base turns the arm plane through the target, which then lies 19.8 ahead of the shoulder,
+        // and the arm stretches out to the upper arm plus the forearm length
+        const float reach = Vector3(0, 0.3f, 2).length() + 1.5f;
+        CHECK_THAT(result.residual, WithinAbs(19.8f - reach, 1e-3));
+    }
+
+    SECTION("clamped to the joint limits") {
+        const auto kine = crane3R();
+        for (const Vector3 target : {Vector3(0, 4.2f, 30), Vector3(0, -10, 5), Vector3(0, 4.2f, -10)}) {
+            REQUIRE(AnalyticalSolver::solveAll(kine, target).empty());
+
+            const auto result = solver.solveIKDetailed(kine, target, kine.meanAngles());
+            CHECK_FALSE(result.converged());
+            checkWithinLimits(kine, result.values);
+            CHECK_THAT(result.residual, WithinAbs(distanceToTarget(kine, result.values, target), 1e-4));
+        }
+    }
+}
+
+TEST_CASE("Unsupported chains are rejected") {
+
+    CHECK(AnalyticalSolver::supports(crane3R()));
+    CHECK(AnalyticalSolver::supports(offsetArm()));
+
+    const auto sevenDof = sevenDofChain();
+    const auto prismatic = KineBuilder()
+                                   .addRevoluteJoint(Vector3::Y(), {-180.f, 180.f})
+                                   .addLink(Vector3::Y())
+                                   .addPrismaticJoint(Vector3::Z(), {0.f, 1.f})
+                                   .addRevoluteJoint(Vector3::X(), {-180.f, 180.f})
+                                   .addLink(Vector3::Z())
+                                   .build();
+    const auto skewed = KineBuilder()
+                                .addRevoluteJoint(Vector3::Y(), {-180.f, 180.f})
+                                .addLink(Vector3::Y())
+                                .addRevoluteJoint(Vector3::X(), {-180.f, 180.f})
+                                .addLink(Vector3::Z())
+                                .addRevoluteJoint(Vector3::Z(), {-180.f, 180.f})
+                                .addLink(Vector3::Z())
+                                .build();
+    const auto parallelBase = KineBuilder()
+                                      .addRevoluteJoint(Vector3::X(), {-180.f, 180.f})
+                                      .addLink(Vector3::Y())
+                                      .addRevoluteJoint(Vector3::X(), {-180.f, 180.f})
+                                      .addLink(Vector3::Z())
+                                      .addRevoluteJoint(Vector3::X(), {-180.f, 180.f})
+                                      .addLink(Vector3::Z())
+                                      .build();
+
+    AnalyticalSolver solver;
+    for (const Kine* kine : {&sevenDof, &prismatic, &skewed, &parallelBase}) {
+        CHECK_FALSE(AnalyticalSolver::supports(*kine));
+        CHECK(AnalyticalSolver::solveAll(*kine, {1, 1, 1}).empty());
+        CHECK_THROWS_AS(solver.solveIK(*kine, {1, 1, 1}, kine->meanAngles()), std::invalid_argument);
+    }
+}
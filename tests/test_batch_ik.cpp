@@ -0,0 +1,108 @@
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "kine/ik/BatchIKSolver.hpp"
+#include "kine/ik/CCDSolver.hpp"
+
+#include "chains.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+
+namespace {
+
+    // Reachable targets, except for index 7 which is far out of reach.
+    std::vector<Vector3> makeTargets(const Kine& kine, size_t count) {
+
+        auto targets = reachableTargets(kine, count);
+        targets[7] = {100, 100, 100};
+        return targets;
+    }
+
+}// namespace
+
+TEST_CASE("Parallel batch matches sequential solves") {
+
+    const auto kine = sevenDofChain();
+    const size_t numDof = kine.numDof();
+    const auto targets = makeTargets(kine, 500);
+    const auto seed = kine.meanAngles();
+
+    BatchIKSolver batch([] { return std::make_unique<CCDSolver>(); }, 4, 0.001f);
+    REQUIRE(batch.numThreads() == 4);
+
+    std::vector<float> results(targets.size() * numDof);
+    std::vector<IKStatus> status(targets.size());
+    batch.solve(kine, targets, seed, results, status);
+
+    CCDSolver sequential;
+    for (size_t i = 0; i < targets.size(); ++i) {
+        const auto expected = sequential.solveIKDetailed(kine, targets[i], seed);
+        const std::vector<float> actual(results.begin() + i * numDof, results.begin() + (i + 1) * numDof);
+        CHECK(actual == expected.values);
+        CHECK((status[i] == IKStatus::Converged) == (expected.residual < 0.001f));
+    }
+    CHECK(status[7] == IKStatus::NotConverged);
+}
+
+TEST_CASE("Per-target seeds and throwing solvers") {
+
+    const auto kine = sevenDofChain();
+    const size_t numDof = kine.numDof();
+    const auto targets = makeTargets(kine, 100);
+
+    std::vector<float> seeds(targets.size() * numDof);
+    for (size_t i = 0; i < seeds.size(); ++i) seeds[i] = static_cast<float>(i % 17);
+
+    BatchIKSolver batch([] { return std::make_unique<ThrowingSolver>(1.f); }, 3);
+    std::vector<float> results(seeds.size());
+    std::vector<IKStatus> status(targets.size());
+    batch.solve(kine, targets, seeds, results, status);
+
+    // failed targets hold their own seed, the others were returned unchanged by the solver
+    CHECK(results == seeds);
+    for (size_t i = 0; i < targets.size(); ++i) {
+        CHECK((status[i] == IKStatus::Failed) == (targets[i].x > 1));
+    }
+    CHECK(status[7] == IKStatus::Failed);
+}
+
+TEST_CASE("Batch rejects mismatched buffers") {
+
+    const auto kine = sevenDofChain();
+    const auto targets = makeTargets(kine, 10);
+    BatchIKSolver batch([] { return std::make_unique<CCDSolver>(); }, 2);
+
+    std::vector<float> results(targets.size() * kine.numDof());
+    std::vector<IKStatus> status(targets.size());
+    CHECK_THROWS_AS(batch.solve(kine, targets, std::vector<float>(3), results, status), std::invalid_argument);
+    CHECK_THROWS_AS(batch.solve(kine, targets, kine.meanAngles(), std::span(results).first(5), status), std::out_of_range);
+}
+
+TEST_CASE("Work-stealing pool runs every index once and rethrows") {
+
+    WorkStealingPool pool(4);
+    std::vector<std::atomic<int>> hits(10000);
+    std::atomic<size_t> maxWorker{0};
+    pool.parallelFor(hits.size(), [&](size_t i, size_t w) {
+        // Catch2 assertions are not thread safe, results are checked afterwards
+        size_t seen = maxWorker;
+        while (w > seen && !maxWorker.compare_exchange_weak(seen, w)) {}
+        ++hits[i];
+    });
+    for (const auto& h : hits) CHECK(h == 1);
+    CHECK(maxWorker < pool.size());
+
+    CHECK_THROWS_AS(pool.parallelFor(1000, [](size_t i, size_t) {
+        if (i == 500) throw std::runtime_error("boom");
+    }), std::runtime_error);
+
+    // the pool stays usable after a task threw
+    std::atomic<size_t> count{0};
+    pool.parallelFor(10, [&](size_t, size_t) { ++count; });
+    CHECK(count == 10);
+}
@@ -0,0 +1,106 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/ik/CCDSolver.hpp"
+
+#include "chains.hpp"
+
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    // A telescoping boom, the prismatic axis is not a unit vector so FK extends it by 2 * value.
+    Kine telescopingBoom() {
+
+        return KineBuilder()
+                .addRevoluteJoint(Vector3::Y(), {-180.f, 180.f})
+                .addLink(Vector3::Y())
+                .addRevoluteJoint(Vector3::X(), {-90.f, 90.f})
+                .addLink(Vector3::Z())
+                .addPrismaticJoint(Vector3::Z() * 2, {0.f, 1.f})
+                .build();
+    }
+
+    void checkWithinLimits(const Kine& kine, const std::vector<float>& values) {
+
+        for (size_t i = 0; i < kine.numDof(); ++i) {
+            const auto& limit = kine.joints()[i]->limit();
+            CHECK(values[i] >= *limit.min());
+            CHECK(values[i] <= *limit.max());
+        }
+    }
+
+}// namespace
+
+TEST_CASE("CCD converges on reachable targets") {
+
+    for (const auto& kine : {crane3R(), sevenDofChain(), telescopingBoom()}) {
+        CCDSolver solver;
+        solver.setEPS(0.001f);
+        size_t converged = 0;
+        const auto targets = reachableTargets(kine, 100);
+        for (const auto& target : targets) {
+            const auto result = solver.solveIKDetailed(kine, target, kine.meanAngles());
+            converged += result.converged();
+
+            Vector3 reached;
+            reached.setFromMatrixPosition(kine.calculateEndEffectorTransformation(result.values));
+            CHECK_THAT(reached.distanceTo(target), WithinAbs(result.residual, 1e-4));
+            checkWithinLimits(kine, result.values);
+        }
+        // CCD may stall in a local minimum now and then
+        CHECK(converged >= targets.size() * 9 / 10);
+    }
+}
+
+TEST_CASE("CCD moves prismatic joints by the scaled axis") {
+
+    const auto kine = KineBuilder().addPrismaticJoint(Vector3::Z() * 2, {0.f, 1.f}).build();
+    CCDSolver solver;
+
+    const auto result = solver.solveIKDetailed(kine, {0, 0, 1.2f}, {0.f});
+    CHECK_THAT(result.values[0], WithinAbs(0.6, 1e-6));
+    CHECK(result.converged());
+    CHECK(result.iterations == 1);
+}
+
+TEST_CASE("CCD clamps revolute and prismatic joints to their limits") {
+
+    const auto kine = telescopingBoom();
+    CCDSolver solver;
+
+    // beyond the reach of the boom, or below what the hinge allows
+    for (const Vector3 target : {Vector3(0, 1, 10), Vector3(0, 1, -10), Vector3(0, -5, 0.5f)}) {
+        const auto result = solver.solveIKDetailed(kine, target, kine.meanAngles());
+        CHECK_FALSE(result.converged());
+        checkWithinLimits(kine, result.values);
+    }
+
+    // fully extended towards the target
+    const auto result = solver.solveIKDetailed(kine, {0, 1, 10}, kine.meanAngles());
+    CHECK_THAT(result.values[1], WithinAbs(0, 1e-3));
+    CHECK_THAT(result.values[2], WithinAbs(1, 1e-6));
+}
+
+TEST_CASE("CCD stops within the eps set through setEPS") {
+
+    const auto kine = sevenDofChain();
+    const auto target = reachableTargets(kine, 1).front();
+
+    CCDSolver solver;
+    solver.setEPS(0.1f);
+    const auto coarse = solver.solveIKDetailed(kine, target, kine.meanAngles());
+    CHECK(coarse.converged());
+    CHECK(coarse.residual < 0.1f);
+
+    solver.setEPS(1e-5f);
+    const auto fine = solver.solveIKDetailed(kine, target, kine.meanAngles());
+    CHECK(fine.converged());
+    CHECK(fine.residual < 1e-5f);
+    CHECK(fine.iterations > coarse.iterations);
+}
@@ -0,0 +1,168 @@
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "kine/ik/DLSSolver.hpp"
+
+#include "chains.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+
+namespace {
+
+    std::atomic<size_t> allocations{0};
+
+    void* countedAlloc(std::size_t size) {
+        ++allocations;
+        if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+        throw std::bad_alloc();
+    }
+
+    void* countedAlloc(std::size_t size, std::align_val_t alignment) {
+        ++allocations;
+        const auto align = static_cast<std::size_t>(alignment);
+        // aligned_alloc wants a multiple of the alignment
+        if (void* p = std::aligned_alloc(align, (size + align - 1) / align * align)) return p;
+        throw std::bad_alloc();
+    }
+
+}// namespace
+
+// counts every heap allocation of this executable, the nothrow forms call these by default
+void* operator new(std::size_t size) {
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size) {
+    return countedAlloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return countedAlloc(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return countedAlloc(size, alignment);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+    struct Query {
+        Vector3 position;
+        Quaternion orientation;
+        std::vector<float> start;
+    };
+
+    std::vector<Query> makeQueries(const Kine& kine, size_t count) {
+
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<float> dist(0.2f, 0.8f);
+
+        std::vector<Query> queries(count);
+        std::vector<float> values(kine.numDof());
+        for (auto& q : queries) {
+            for (auto& v : values) v = dist(gen);
+            const auto m = kine.calculateEndEffectorTransformation(values, true);
+            q.position.setFromMatrixPosition(m);
+            q.orientation.setFromRotationMatrix(m);
+            q.start = kine.meanAngles();
+        }
+        return queries;
+    }
+
+    // Heap allocations made by solving every query into a preallocated span, after one warm-up solve.
+    template<class Solver>
+    size_t allocationsAfterWarmUp(Solver& solver, const Kine& kine, const std::vector<Query>& queries) {
+
+        std::vector<float> result(kine.numDof());
+        solver.solveIK(kine, queries.front().position, queries.front().start, result);
+        solver.solve(kine, queries.front().position, queries.front().orientation, result);
+
+        const size_t before = allocations;
+        for (int repeat = 0; repeat < 3; ++repeat) {
+            for (const auto& q : queries) {
+                solver.solveIK(kine, q.position, q.start, result);
+                solver.solve(kine, q.position, q.orientation, result);
+            }
+        }
+        return allocations - before;
+    }
+
+}// namespace
+
+TEST_CASE("DLSSolver span solves do not allocate after warm-up") {
+
+    const auto kine = crane3R();
+    const auto queries = makeQueries(kine, 100);
+
+    DLSSolver solver;
+    CHECK(allocationsAfterWarmUp(solver, kine, queries) == 0);
+}
+
+TEST_CASE("Fixed-size DLSSolver span solves do not allocate after warm-up") {
+
+    const auto kine = crane3R();
+    const auto queries = makeQueries(kine, 100);
+
+    BasicDLSSolver<3> solver;
+    CHECK(allocationsAfterWarmUp(solver, kine, queries) == 0);
+}
+
+TEST_CASE("The allocation counter sees heap allocations") {
+
+    size_t before = allocations;
+    const auto values = std::make_unique<std::vector<float>>(16);
+    CHECK(allocations - before >= 2);
+
+    before = allocations;
+    const auto array = std::make_unique<float[]>(16);
+    CHECK(allocations - before == 1);
+
+    struct alignas(64) Aligned {
+        float values[16];
+    };
+    before = allocations;
+    const auto aligned = std::make_unique<Aligned>();
+    CHECK(allocations - before == 1);
+    CHECK(reinterpret_cast<std::uintptr_t>(aligned.get()) % 64 == 0);
+}
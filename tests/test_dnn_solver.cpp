@@ -0,0 +1,35 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/ik/DNNSolver.hpp"
+
+#include "chains.hpp"
+
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("DNN batches match single solves") {
+
+    const auto kine = crane3R();
+    const auto targets = reachableTargets(kine, 37);
+    const size_t numDof = kine.numDof();
+
+    // several full batches followed by a partial one
+    DNNSolver solver(KINE_CRANE3R_MODEL, 16);
+
+    std::vector<float> results(targets.size() * numDof);
+    std::vector<float> residuals(targets.size());
+    solver.solveBatch(kine, targets, results, residuals);
+
+    for (size_t i = 0; i < targets.size(); ++i) {
+        const auto single = solver.solveIKDetailed(kine, targets[i], kine.meanAngles());
+        for (size_t j = 0; j < numDof; ++j) {
+            CHECK_THAT(results[i * numDof + j], WithinAbs(single.values[j], 1e-4));
+        }
+        CHECK_THAT(residuals[i], WithinAbs(single.residual, 1e-4));
+    }
+}
@@ -0,0 +1,73 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/ik/FABRIKSolver.hpp"
+
+#include "chains.hpp"
+
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    void checkWithinLimits(const Kine& kine, const std::vector<float>& values) {
+
+        for (size_t i = 0; i < kine.numDof(); ++i) {
+            const auto& limit = kine.joints()[i]->limit();
+            CHECK(values[i] >= *limit.min());
+            CHECK(values[i] <= *limit.max());
+        }
+    }
+
+}// namespace
+
+TEST_CASE("FABRIK converges on reachable targets") {
+
+    for (const auto& kine : {crane3R(), sevenDofChain()}) {
+        FABRIKSolver solver;
+        solver.setEPS(0.001f);
+        size_t converged = 0;
+        const auto targets = reachableTargets(kine, 100);
+        for (const auto& target : targets) {
+            const auto result = solver.solveIKDetailed(kine, target, kine.meanAngles());
+            converged += result.converged();
+
+            Vector3 reached;
+            reached.setFromMatrixPosition(kine.calculateEndEffectorTransformation(result.values));
+            CHECK_THAT(reached.distanceTo(target), WithinAbs(result.residual, 1e-4));
+        }
+        CHECK(converged >= targets.size() * 9 / 10);
+    }
+}
+
+TEST_CASE("FABRIK respects the joint limits") {
+
+    const auto kine = crane3R();
+    FABRIKSolver solver;
+
+    SECTION("reachable targets") {
+        for (const auto& target : reachableTargets(kine, 50, 7)) {
+            checkWithinLimits(kine, solver.solveIK(kine, target, kine.meanAngles()));
+        }
+    }
+
+    SECTION("targets out of reach or behind the limits") {
+        // the base turns only +-90 degrees and the boom cannot dip below its pivot
+        for (const Vector3 target : {Vector3(0, 4.2f, -12), Vector3(0, -20, 5), Vector3(30, 30, 30)}) {
+            const auto result = solver.solveIKDetailed(kine, target, kine.meanAngles());
+            CHECK_FALSE(result.converged());
+            checkWithinLimits(kine, result.values);
+        }
+    }
+
+    SECTION("start values outside the limits") {
+        const auto target = reachableTargets(kine, 1).front();
+        const auto result = solver.solveIKDetailed(kine, target, {170.f, 60.f, -10.f});
+        checkWithinLimits(kine, result.values);
+        CHECK(result.converged());
+    }
+}
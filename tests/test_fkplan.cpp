@@ -0,0 +1,71 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/Kine.hpp"
+
+#include "chains.hpp"
+
+#include <random>
+
+using namespace kine;
+using namespace kine::test;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    // revolute and prismatic joints around principal and skewed axes, with consecutive links to fuse
+    Kine mixedChain() {
+        return KineBuilder()
+                .addLink({0.1f, 0.5f, 0})
+                .addPrismaticJoint(Vector3::Z(), {0.f, 2.f})
+                .addLink({0.3f, 0, 1})
+                .addLink({0, 0.2f, 0})
+                .addRevoluteJoint(Vector3(1, 1, 0).normalize(), {-120.f, 120.f})
+                .addRevoluteJoint(Vector3::Z(), {-90.f, 90.f})
+                .addLink({1, 0, 0})
+                .addPrismaticJoint(Vector3(0, 1, 1).normalize(), {-0.5f, 0.5f})
+                .addRevoluteJoint(Vector3::X(), {-90.f, 90.f})
+                .addLink({0, 0.5f, 0.2f})
+                .build();
+    }
+
+    void checkPlansAgree(const Kine& kine) {
+
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(0, 1);
+        std::vector<float> values(kine.numDof());
+
+        for (int i = 0; i < 200; ++i) {
+            for (auto& v : values) v = dist(gen);
+            const bool normalized = i % 2 == 0;
+
+            Matrix4 optimized, unoptimized;
+            kine.plan().evaluate(values, normalized, optimized);
+            kine.unoptimizedPlan().evaluate(values, normalized, unoptimized);
+
+            for (size_t e = 0; e < 16; ++e) {
+                CHECK_THAT(optimized.elements[e], WithinAbs(unoptimized.elements[e], 1e-4));
+            }
+        }
+    }
+
+}// namespace
+
+TEST_CASE("Optimized plan fuses constant links") {
+
+    const auto kine = mixedChain();
+
+    CHECK(kine.plan().numDof() == kine.numDof());
+    CHECK(kine.plan().steps().size() < kine.unoptimizedPlan().steps().size());
+}
+
+TEST_CASE("Optimized and unoptimized plans agree on Crane3R") {
+
+    checkPlansAgree(crane3R());
+}
+
+TEST_CASE("Optimized and unoptimized plans agree on a mixed chain") {
+
+    checkPlansAgree(mixedChain());
+}
@@ -0,0 +1,101 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/ik/CCDSolver.hpp"
+#include "kine/ik/DLSSolver.hpp"
+#include "kine/ik/FABRIKSolver.hpp"
+#include "kine/ik/LMSolver.hpp"
+
+#include "chains.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+using namespace std::chrono_literals;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    std::vector<std::unique_ptr<IKSolver>> iterativeSolvers() {
+
+        std::vector<std::unique_ptr<IKSolver>> solvers;
+        solvers.emplace_back(std::make_unique<CCDSolver>());
+        solvers.emplace_back(std::make_unique<DLSSolver>());
+        solvers.emplace_back(std::make_unique<LMSolver>());
+        solvers.emplace_back(std::make_unique<FABRIKSolver>());
+        return solvers;
+    }
+
+    float distanceToTarget(const Kine& kine, const std::vector<float>& values, const Vector3& target) {
+
+        Vector3 reached;
+        reached.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values));
+        return reached.distanceTo(target);
+    }
+
+}// namespace
+
+TEST_CASE("An iteration budget stops the solve after that many iterations") {
+
+    const auto kine = sevenDofChain();
+    const Vector3 target(10, 10, 10);// out of reach, no solver converges
+
+    for (const auto& solver : iterativeSolvers()) {
+        for (const unsigned int budget : {1u, 3u, 10u}) {
+            solver->setBudget({0us, budget});
+            const auto result = solver->solveIKDetailed(kine, target, kine.meanAngles());
+            CHECK(result.termination == IKTermination::BudgetExhausted);
+            CHECK(result.iterations == budget);
+        }
+    }
+}
+
+TEST_CASE("DLS and FABRIK return the best values so far when the budget runs out") {
+
+    const auto kine = sevenDofChain();
+    const auto start = kine.meanAngles();
+
+    std::vector<std::unique_ptr<IKSolver>> solvers;
+    solvers.emplace_back(std::make_unique<DLSSolver>());
+    solvers.emplace_back(std::make_unique<FABRIKSolver>());
+
+    for (const auto& solver : solvers) {
+        for (const auto& target : reachableTargets(kine, 20)) {
+            float previous = distanceToTarget(kine, start, target);
+            for (unsigned int budget = 1; budget <= 10; ++budget) {
+                solver->setBudget({0us, budget});
+                const auto result = solver->solveIKDetailed(kine, target, start);
+
+                // the residual belongs to the values returned, and a larger budget never does worse
+                CHECK_THAT(distanceToTarget(kine, result.values, target), WithinAbs(result.residual, 1e-4));
+                CHECK(result.residual <= previous);
+                previous = result.residual;
+            }
+        }
+    }
+}
+
+TEST_CASE("A zero budget leaves the solve unbounded") {
+
+    const auto kine = sevenDofChain();
+    const auto target = reachableTargets(kine, 1).front();
+
+    for (const auto& solver : iterativeSolvers()) {
+        solver->setEPS(0.001f);
+        const auto unbounded = solver->solveIKDetailed(kine, target, kine.meanAngles());
+        REQUIRE(unbounded.converged());
+        REQUIRE(unbounded.iterations > 1);
+
+        solver->setBudget({0us, 1});
+        CHECK(solver->solveIKDetailed(kine, target, kine.meanAngles()).termination == IKTermination::BudgetExhausted);
+
+        solver->setBudget({});
+        const auto result = solver->solveIKDetailed(kine, target, kine.meanAngles());
+        CHECK(result.converged());
+        CHECK(result.iterations == unbounded.iterations);
+        CHECK(result.values == unbounded.values);
+    }
+}
@@ -0,0 +1,102 @@
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "kine/ik/BatchIKSolver.hpp"
+#include "kine/ik/SeedCache.hpp"
+
+#include "chains.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+
+namespace {
+
+    // Implements only the vector solveIK, leaving everything else to the IKSolver defaults.
+    struct FixedSolver: IKSolver {
+
+        std::vector<float> values;
+
+        explicit FixedSolver(std::vector<float> values)
+            : values(std::move(values)) {}
+
+        using IKSolver::solveIK;
+
+        std::vector<float> solveIK(const Kine&, const Vector3&, const std::vector<float>&) override {
+            return values;
+        }
+    };
+
+    Vector3 endEffector(const Kine& kine, const std::vector<float>& values) {
+
+        Vector3 p;
+        p.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values));
+        return p;
+    }
+
+}// namespace
+
+TEST_CASE("Default solveIKDetailed reports a fresh solve") {
+
+    const auto kine = crane3R();
+    const auto values = kine.meanAngles();
+    const auto reached = endEffector(kine, values);
+    const Vector3 target = reached + Vector3(3, 0, 0);
+
+    FixedSolver solver(values);
+    // let a stale start time show up in the wall time
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    solver.setEPS(100);
+    auto result = solver.solveIKDetailed(kine, target, values);
+    CHECK(result.values == values);
+    CHECK(result.residual == reached.distanceTo(target));
+    CHECK(result.converged());
+    CHECK(result.termination == IKTermination::Converged);
+    CHECK(solver.converged());
+    CHECK(result.wallTime < std::chrono::milliseconds(20));
+
+    // a later solve missing eps does not inherit the previous outcome
+    solver.setEPS(0.001f);
+    result = solver.solveIKDetailed(kine, target, values);
+    CHECK_FALSE(result.converged());
+    CHECK(result.termination == IKTermination::NotConverged);
+    CHECK_FALSE(solver.converged());
+}
+
+TEST_CASE("Default span solveIK goes through the fresh solve") {
+
+    const auto kine = crane3R();
+    const auto values = kine.meanAngles();
+    const Vector3 target = endEffector(kine, values);
+
+    FixedSolver solver(values);
+    std::vector<float> result(kine.numDof());
+    const auto stats = solver.solveIK(kine, target, kine.meanAngles(), result);
+    CHECK(result == values);
+    CHECK(stats.converged());
+    CHECK(stats.residual < 0.001f);
+}
+
+TEST_CASE("Wrappers see convergence of solveIK-only solvers") {
+
+    const auto kine = crane3R();
+    const auto values = kine.meanAngles();
+    const Vector3 target = endEffector(kine, values);
+
+    SeedCachedSolver cached(std::make_unique<FixedSolver>(values));
+    const auto result = cached.solveIKDetailed(kine, target, values);
+    CHECK(result.converged());
+    CHECK(cached.cache().size() == 1);
+
+    BatchIKSolver batch([&] { return std::make_unique<FixedSolver>(values); }, 2);
+    const std::vector<Vector3> targets{target, target + Vector3(1, 0, 0)};
+    std::vector<float> results(targets.size() * kine.numDof());
+    std::vector<IKStatus> status(targets.size());
+    batch.solve(kine, targets, values, results, status);
+    CHECK(status[0] == IKStatus::Converged);
+    CHECK(status[1] == IKStatus::NotConverged);
+}
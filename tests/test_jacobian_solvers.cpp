@@ -0,0 +1,102 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/ik/DLSSolver.hpp"
+#include "kine/ik/LMSolver.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace kine;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    Kine sixDofArm() {
+
+        return KineBuilder()
+                .addRevoluteJoint(Vector3::Y(), {-180.f, 180.f})
+                .addLink(Vector3::Y() * 0.5f)
+                .addRevoluteJoint(Vector3::X(), {-90.f, 90.f})
+                .addLink(Vector3::Y())
+                .addRevoluteJoint(Vector3::X(), {-150.f, 150.f})
+                .addLink(Vector3(0, 0.2f, 0.1f))
+                .addRevoluteJoint(Vector3::Y(), {-180.f, 180.f})
+                .addLink(Vector3::Y() * 0.8f)
+                .addRevoluteJoint(Vector3::X(), {-120.f, 120.f})
+                .addLink(Vector3::Y() * 0.1f)
+                .addRevoluteJoint(Vector3::Y(), {-180.f, 180.f})
+                .addLink(Vector3::Y() * 0.1f)
+                .build();
+    }
+
+    // Checks the residuals a pose solve reports against the pose reached by the returned values.
+    template<class Solver>
+    void checkPoseResiduals(Solver& solver, const PoseWeights& weights) {
+
+        const auto kine = sixDofArm();
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<float> dist(0.2f, 0.8f);
+
+        std::vector<float> values(kine.numDof());
+        for (int i = 0; i < 50; ++i) {
+            for (auto& v : values) v = dist(gen);
+            const auto m = kine.calculateEndEffectorTransformation(values, true);
+            // out of reach, so neither residual vanishes
+            Vector3 position;
+            position.setFromMatrixPosition(m);
+            position *= 1.5f;
+            Quaternion orientation;
+            orientation.setFromRotationMatrix(m);
+
+            const auto solution = solver.solveIK(kine, position, orientation, kine.meanAngles(), weights);
+
+            const auto reached = kine.calculateEndEffectorTransformation(solution);
+            Vector3 reachedPosition;
+            reachedPosition.setFromMatrixPosition(reached);
+            Quaternion reachedOrientation;
+            reachedOrientation.setFromRotationMatrix(reached);
+            const float angle = 2 * std::acos(std::min(1.f, std::abs(orientation.dot(reachedOrientation))));
+
+            REQUIRE(solver.residual() > 0.01f);
+            CHECK_THAT(solver.residual(), WithinAbs(reachedPosition.distanceTo(position), 1e-4));
+            CHECK_THAT(solver.orientationResidual(), WithinAbs(angle, 2e-3));
+        }
+    }
+
+}// namespace
+
+TEST_CASE("DLS pose solves report position and orientation residuals") {
+
+    DLSSolver solver;
+    checkPoseResiduals(solver, {});
+    // weights only change what the solve converges on, not how the residuals are measured
+    checkPoseResiduals(solver, {{10, 10, 10}, {0.1f, 0.1f, 0.1f}});
+}
+
+TEST_CASE("LM pose solves report position and orientation residuals") {
+
+    LMSolver solver;
+    checkPoseResiduals(solver, {});
+    checkPoseResiduals(solver, {{10, 10, 10}, {0.1f, 0.1f, 0.1f}});
+}
+
+TEST_CASE("Position solves report the distance and no orientation residual") {
+
+    const auto kine = sixDofArm();
+    const Vector3 target(0.3f, 1.5f, 0.4f);
+
+    DLSSolver dls;
+    LMSolver lm;
+    for (IKSolver* solver : {static_cast<IKSolver*>(&dls), static_cast<IKSolver*>(&lm)}) {
+        const auto result = solver->solveIKDetailed(kine, target, kine.meanAngles());
+        Vector3 reached;
+        reached.setFromMatrixPosition(kine.calculateEndEffectorTransformation(result.values));
+        CHECK_THAT(result.residual, WithinAbs(reached.distanceTo(target), 1e-4));
+        CHECK(solver->residual() == result.residual);
+    }
+    CHECK(dls.orientationResidual() == 0);
+    CHECK(lm.orientationResidual() == 0);
+}
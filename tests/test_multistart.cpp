@@ -0,0 +1,90 @@
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "kine/ik/CCDSolver.hpp"
+#include "kine/ik/MultiStartSolver.hpp"
+
+#include "chains.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <stop_token>
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+
+namespace {
+
+    // Returns its start values, recording the eps it was configured with.
+    struct RecordingSolver: IKSolver {
+
+        std::atomic<float>& eps;
+
+        explicit RecordingSolver(std::atomic<float>& eps)
+            : eps(eps) {}
+
+        std::vector<float> solveIK(const Kine&, const Vector3&, const std::vector<float>& startValues) override {
+            eps = eps_;
+            return startValues;
+        }
+    };
+
+}// namespace
+
+TEST_CASE("Multi-start solves converge across repeated calls") {
+
+    const auto kine = sevenDofChain();
+    MultiStartSolver solver([] { return std::make_unique<CCDSolver>(); }, 8, 4);
+
+    std::vector<float> values(kine.numDof());
+    for (int i = 0; i < 50; ++i) {
+        for (size_t j = 0; j < values.size(); ++j) values[j] = static_cast<float>((i * 7 + j * 3) % 10) / 10;
+        Vector3 target;
+        target.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values, true));
+
+        const auto result = solver.solveIKDetailed(kine, target, kine.meanAngles());
+        CHECK(result.converged());
+        Vector3 reached;
+        reached.setFromMatrixPosition(kine.calculateEndEffectorTransformation(result.values));
+        CHECK(reached.distanceTo(target) < 0.001f);
+    }
+}
+
+TEST_CASE("Multi-start forwards eps to the inner solvers") {
+
+    const auto kine = sevenDofChain();
+    std::atomic<float> eps{0};
+    MultiStartSolver solver([&] { return std::make_unique<RecordingSolver>(eps); }, 4, 2);
+
+    solver.setEPS(0.25f);
+    solver.solveIK(kine, Vector3::Y(), kine.meanAngles());
+    CHECK(eps == 0.25f);
+
+    solver.setEPS(0.5f);
+    solver.solveIK(kine, Vector3::Y(), kine.meanAngles());
+    CHECK(eps == 0.5f);
+}
+
+TEST_CASE("Multi-start rethrows and stays usable") {
+
+    const auto kine = sevenDofChain();
+    MultiStartSolver throwing([] { return std::make_unique<ThrowingSolver>(); }, 4, 4);
+    CHECK_THROWS_AS(throwing.solveIK(kine, Vector3::Y(), kine.meanAngles()), std::runtime_error);
+    CHECK_THROWS_AS(throwing.solveIK(kine, Vector3::Y(), kine.meanAngles()), std::runtime_error);
+}
+
+TEST_CASE("Cancelled multi-start solves return the start values") {
+
+    const auto kine = sevenDofChain();
+    MultiStartSolver solver([] { return std::make_unique<CCDSolver>(); }, 8, 4);
+
+    std::stop_source stop;
+    stop.request_stop();
+    solver.setStopToken(stop.get_token());
+
+    const auto start = kine.meanAngles();
+    const auto result = solver.solveIKDetailed(kine, {100, 100, 100}, start);
+    CHECK(result.values == start);
+    CHECK(result.termination == IKTermination::Cancelled);
+}
@@ -0,0 +1,154 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/ik/CCDSolver.hpp"
+#include "kine/ik/SeedCache.hpp"
+
+#include "chains.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("SeedCache returns the nearest entry within one cell") {
+
+    SeedCache cache(1.f, 3);
+    cache.store({0, 0, 0}, std::vector<float>{1, 2});
+    cache.store({0.8f, 0, 0}, std::vector<float>{2, 2});
+
+    const auto* seed = cache.lookup({0.3f, 0, 0});
+    REQUIRE(seed != nullptr);
+    CHECK((*seed)[0] == 1);
+    seed = cache.lookup({0.6f, 0, 0});
+    REQUIRE(seed != nullptr);
+    CHECK((*seed)[0] == 2);
+
+    // two cells away
+    CHECK(cache.lookup({-2.5f, 0, 0}) == nullptr);
+
+    CHECK(cache.stats().hits == 2);
+    CHECK(cache.stats().misses == 1);
+    CHECK(cache.stats().hitRate() == 2.f / 3.f);
+}
+
+TEST_CASE("SeedCache merges close targets") {
+
+    SeedCache cache(1.f, 8);
+    cache.store({0, 0, 0}, std::vector<float>{1});
+    cache.store({0.001f, 0, 0}, std::vector<float>{9});
+
+    CHECK(cache.size() == 1);
+    CHECK((*cache.lookup({0, 0, 0}))[0] == 9);
+}
+
+TEST_CASE("SeedCache evicts the least recently used entry") {
+
+    SeedCache cache(1.f, 3);
+    cache.store({0, 0, 0}, std::vector<float>{1});
+    cache.store({5, 0, 0}, std::vector<float>{2});
+    cache.store({10, 0, 0}, std::vector<float>{3});
+
+    // touching the first entry makes the second the least recently used
+    REQUIRE(cache.lookup({0, 0, 0}) != nullptr);
+    cache.store({20, 0, 0}, std::vector<float>{4});
+
+    CHECK(cache.size() == 3);
+    CHECK(cache.stats().evictions == 1);
+    CHECK(cache.lookup({5, 0, 0}) == nullptr);
+    CHECK(cache.lookup({0, 0, 0}) != nullptr);
+    CHECK(cache.lookup({10, 0, 0}) != nullptr);
+    CHECK(cache.lookup({20, 0, 0}) != nullptr);
+
+    SeedCache disabled(1.f, 0);
+    disabled.store({0, 0, 0}, std::vector<float>{1});
+    CHECK(disabled.size() == 0);
+}
+
+TEST_CASE("SeedCachedSolver reuses solutions of nearby targets") {
+
+    const auto kine = sevenDofChain();
+
+    // targets scattered around a few reachable centers
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<float> dist(0.2f, 0.8f);
+    std::normal_distribution<float> noise(0, 0.1f);
+    std::vector<Vector3> centers(3);
+    std::vector<float> values(kine.numDof());
+    for (auto& c : centers) {
+        for (auto& v : values) v = dist(gen);
+        c.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values, true));
+    }
+    std::vector<Vector3> targets;
+    for (int i = 0; i < 300; ++i) {
+        targets.emplace_back(centers[i / 20 % centers.size()] + Vector3(noise(gen), noise(gen), noise(gen)));
+    }
+
+    const auto start = kine.meanAngles();
+    CCDSolver plain;
+    SeedCachedSolver cached(std::make_unique<CCDSolver>(), 0.25f, 64);
+
+    size_t plainIterations = 0, cachedIterations = 0, plainConverged = 0, cachedConverged = 0;
+    for (const auto& target : targets) {
+        const auto p = plain.solveIKDetailed(kine, target, start);
+        const auto c = cached.solveIKDetailed(kine, target, start);
+        plainIterations += p.iterations;
+        cachedIterations += c.iterations;
+        plainConverged += p.converged();
+        cachedConverged += c.converged();
+
+        Vector3 reached;
+        reached.setFromMatrixPosition(kine.calculateEndEffectorTransformation(c.values));
+        CHECK_THAT(reached.distanceTo(target), WithinAbs(c.residual, 1e-5));
+    }
+
+    CHECK(cachedConverged >= plainConverged);
+    CHECK(cachedIterations < plainIterations);
+    CHECK(cached.cache().stats().hitRate() > 0.5f);
+    CHECK(cached.cache().size() <= 64);
+
+    // solving for another chain starts from an empty cache
+    const auto other = KineBuilder().addRevoluteJoint(Vector3::Z(), {-180.f, 180.f}).addLink(Vector3::X()).build();
+    cached.solveIK(other, Vector3::Y(), std::vector<float>{0});
+    CHECK(cached.cache().size() <= 1);
+}
+
+TEST_CASE("SeedCachedSolver forwards eps to the wrapped solver") {
+
+    const auto kine = sevenDofChain();
+    const auto targets = reachableTargets(kine, 20);
+
+    // tighter than the default eps of the wrapped solver, which would otherwise stop short of it
+    SeedCachedSolver cached(std::make_unique<CCDSolver>());
+    cached.setEPS(1e-6f);
+    size_t converged = 0;
+    for (const auto& target : targets) {
+        const auto result = cached.solveIKDetailed(kine, target, kine.meanAngles());
+        if (result.converged()) {
+            ++converged;
+            CHECK(result.residual < 1e-6f);
+        }
+    }
+    CHECK(converged > 0);
+    CHECK(cached.cache().size() == converged);
+}
+
+TEST_CASE("SeedCachedSolver pose solves report their own outcome") {
+
+    const auto kine = sevenDofChain();
+    SeedCachedSolver cached(std::make_unique<CCDSolver>());
+
+    const auto target = reachableTargets(kine, 1).front();
+    REQUIRE(cached.solveIKDetailed(kine, target, kine.meanAngles()).converged());
+
+    // CCD solves pose targets for the position only, a far target cannot converge
+    const Vector3 far(100, 100, 100);
+    const auto values = cached.solveIK(kine, far, Quaternion(), kine.meanAngles());
+    Vector3 reached;
+    reached.setFromMatrixPosition(kine.calculateEndEffectorTransformation(values));
+    CHECK_FALSE(cached.converged());
+    CHECK_THAT(cached.residual(), WithinAbs(reached.distanceTo(far), 1e-3));
+}
@@ -0,0 +1,88 @@
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "kine/KineState.hpp"
+#include "kine/ik/CCDSolver.hpp"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace kine;
+
+namespace {
+
+    Kine mixedChain() {
+
+        return KineBuilder()
+                .addRevoluteJoint(Vector3::Y(), {-90.f, 90.f})
+                .addLink(Vector3::Y())
+                .addPrismaticJoint(Vector3(1, 1, 0).normalize(), {0.f, 2.f})
+                .addRevoluteJoint(Vector3::X(), {-80.f, 80.f})
+                .addLink(Vector3::Y())
+                .build();
+    }
+
+    struct Query {
+        std::vector<float> values;
+        Vector3 target;
+    };
+
+    std::vector<Query> makeQueries(const Kine& kine, size_t count) {
+
+        std::mt19937 gen(1);
+        std::uniform_real_distribution<float> dist(0, 1);
+
+        std::vector<Query> queries(count);
+        for (auto& q : queries) {
+            std::vector<float> normalized(kine.numDof());
+            for (auto& v : normalized) v = dist(gen);
+            q.values = kine.denormalizeValues(normalized);
+            q.target = Vector3(dist(gen), 1 + dist(gen), dist(gen));
+        }
+        return queries;
+    }
+
+    // End-effector position and IK solution of a query, computed with state private to the caller.
+    std::pair<Vector3, std::vector<float>> evaluate(const Kine& kine, CCDSolver& solver, const Query& q) {
+
+        KineState state(kine, q.values);
+        const auto position = state.getEndEffectorTransformation().getPosition();
+        return {position, solver.solveIK(kine, q.target, q.values)};
+    }
+
+}// namespace
+
+TEST_CASE("Threads sharing one Kine match sequential evaluation") {
+
+    const auto kine = mixedChain();
+    const auto queries = makeQueries(kine, 200);
+
+    CCDSolver sequentialSolver;
+    std::vector<std::pair<Vector3, std::vector<float>>> expected;
+    for (const auto& q : queries) {
+        expected.emplace_back(evaluate(kine, sequentialSolver, q));
+    }
+
+    const size_t numThreads = 8;
+    std::vector<std::vector<std::pair<Vector3, std::vector<float>>>> results(numThreads);
+    {
+        std::vector<std::jthread> threads;
+        for (size_t t = 0; t < numThreads; ++t) {
+            threads.emplace_back([&, t] {
+                CCDSolver solver;
+                for (const auto& q : queries) {
+                    results[t].emplace_back(evaluate(kine, solver, q));
+                }
+            });
+        }
+    }
+
+    for (const auto& result : results) {
+        REQUIRE(result.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            CHECK(result[i].first == expected[i].first);
+            CHECK(result[i].second == expected[i].second);
+        }
+    }
+}
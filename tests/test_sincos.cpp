@@ -0,0 +1,92 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/Kine.hpp"
+#include "kine/math/SinCos.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace kine;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    // Maximum absolute error against double precision over |angle| <= 1e4, with a tail that is not a multiple of 8.
+    double maxError(SinCosAccuracy accuracy) {
+
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-1e4f, 1e4f);
+        std::vector<float> angles(100003);
+        for (auto& a : angles) a = dist(gen);
+        // exact multiples of pi/2 and the ends of the range
+        angles[0] = 0;
+        angles[1] = 1e4f;
+        angles[2] = -1e4f;
+        angles[3] = 1.5707964f;
+
+        std::vector<float> sines(angles.size()), cosines(angles.size());
+        sincos(angles, sines, cosines, accuracy);
+
+        double error = 0;
+        for (size_t i = 0; i < angles.size(); ++i) {
+            error = std::max(error, std::abs(sines[i] - std::sin(static_cast<double>(angles[i]))));
+            error = std::max(error, std::abs(cosines[i] - std::cos(static_cast<double>(angles[i]))));
+        }
+        return error;
+    }
+
+}// namespace
+
+TEST_CASE("Precise sincos stays within 1e-7") {
+
+    CHECK(maxError(SinCosAccuracy::Precise) <= 1e-7);
+}
+
+TEST_CASE("Fast sincos stays within 1.5e-5") {
+
+    CHECK(maxError(SinCosAccuracy::Fast) <= 1.5e-5);
+}
+
+TEST_CASE("Batched FK matches single evaluation in every lane") {
+
+    const auto kine = KineBuilder()
+                              .addRevoluteJoint(Vector3::Y(), {-180.f, 180.f})
+                              .addLink(Vector3::Y() * 4.2)
+                              .addPrismaticJoint(Vector3::Z(), {0.f, 2.f})
+                              .addRevoluteJoint(Vector3(1, 0, 1).normalize(), {-120.f, 120.f})
+                              .addLink(Vector3::Z() * 7)
+                              .addRevoluteJoint(Vector3::X(), {40.f, 140.f})
+                              .addLink(Vector3::Z() * 5.2)
+                              .build();
+    const size_t numDof = kine.numDof();
+
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> dist(0, 1);
+
+    for (const size_t count : {1, 8, 21, 64, 67}) {
+        for (const auto accuracy : {SinCosAccuracy::Precise, SinCosAccuracy::Fast}) {
+
+            // joint j of configuration i is stored at j * count + i
+            std::vector<float> values(numDof * count);
+            for (auto& v : values) v = dist(gen);
+
+            std::vector<Matrix4> batch(count);
+            kine.calculateEndEffectorTransformations(values, batch, true, accuracy);
+
+            // positions reach ~15 length units, the fast tier is scaled accordingly
+            const double tolerance = accuracy == SinCosAccuracy::Precise ? 1e-4 : 1e-3;
+            std::vector<float> single(numDof);
+            for (size_t i = 0; i < count; ++i) {
+                for (size_t j = 0; j < numDof; ++j) single[j] = values[j * count + i];
+                const auto expected = kine.calculateEndEffectorTransformation(single, true);
+                for (size_t e = 0; e < 16; ++e) {
+                    CHECK_THAT(batch[i].elements[e], WithinAbs(expected.elements[e], tolerance));
+                }
+            }
+        }
+    }
+}
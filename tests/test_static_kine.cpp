@@ -0,0 +1,88 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/StaticKine.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace kine;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    // Compares FK and the Jacobian of a StaticKine with those of the Kine it builds, for random values within the limits.
+    template<class... Components>
+    void checkMatchesKine(const StaticKine<Components...>& staticKine, bool normalized) {
+
+        using Values = typename StaticKine<Components...>::Values;
+
+        const Kine kine = staticKine.toKine();
+        REQUIRE(kine.numDof() == staticKine.numDof());
+
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(0.f, 1.f);
+        const auto limits = staticKine.limits();
+
+        for (int n = 0; n < 100; ++n) {
+            Values values;
+            for (size_t i = 0; i < values.size(); ++i) {
+                values[i] = normalized ? dist(gen) : limits[i].denormalize(dist(gen));
+            }
+            const std::vector<float> dynamicValues(values.begin(), values.end());
+
+            const Matrix4 expected = kine.calculateEndEffectorTransformation(dynamicValues, normalized);
+            const Matrix4 actual = staticKine.calculateEndEffectorTransformation(values, normalized);
+            for (int k = 0; k < 16; ++k) {
+                CHECK_THAT(actual.elements[k], WithinAbs(expected.elements[k], 1e-4));
+            }
+
+            std::vector<float> expectedJacobian(3 * kine.numDof());
+            kine.computeJacobian(dynamicValues, expectedJacobian, normalized);
+            const auto jacobian = staticKine.computeJacobian(values, normalized);
+            for (size_t k = 0; k < jacobian.size(); ++k) {
+                CHECK_THAT(jacobian[k], WithinAbs(expectedJacobian[k], 1e-4));
+            }
+        }
+    }
+
+}// namespace
+
+TEST_CASE("StaticKine agrees with toKine()") {
+
+    SECTION("static links") {
+        const StaticKine<Revolute<Axis::Y>, StaticLink<0.f, 4.2f, 0.f>,
+                         Revolute<Axis::X>, StaticLink<0.f, 0.f, 7.f>,
+                         Revolute<Axis::X>, StaticLink<0.f, 0.f, 5.2f>>
+                crane({{-90.f, 90.f}}, {}, {{-80.f, 0.f}}, {}, {{40.f, 140.f}}, {});
+
+        for (const bool normalized : {false, true}) {
+            checkMatchesKine(crane, normalized);
+        }
+    }
+
+    SECTION("runtime links") {
+        const StaticKine<Revolute<Axis::Y>, Link, Revolute<Axis::X>, Link, Revolute<Axis::X>, Link>
+                crane({{-90.f, 90.f}}, {0, 4.2f, 0}, {{-80.f, 0.f}}, {0, 0, 7}, {{40.f, 140.f}}, {0, 0, 5.2f});
+
+        for (const bool normalized : {false, true}) {
+            checkMatchesKine(crane, normalized);
+        }
+    }
+
+    SECTION("mixed links and prismatic joints") {
+        const StaticKine<Revolute<Axis::Z>, StaticLink<0.5f, 0.f, 1.f>,
+                         Prismatic<Axis::Y>, Link,
+                         Revolute<Axis::X>, StaticLink<0.f, -0.3f, 0.f>, Link,
+                         Prismatic<Axis::Z>, Revolute<Axis::Y>, Link>
+                arm({{-180.f, 180.f}}, {},
+                    {{0.f, 2.f}}, {0.1f, 0.2f, 0.3f},
+                    {{-45.f, 120.f}}, {}, {0, 0, 1.5f},
+                    {{-0.5f, 0.5f}}, {{-90.f, 90.f}}, {0.f, 0.7f, -0.2f});
+
+        for (const bool normalized : {false, true}) {
+            checkMatchesKine(arm, normalized);
+        }
+    }
+}
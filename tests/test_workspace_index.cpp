@@ -0,0 +1,108 @@
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "kine/ik/WorkspaceIndex.hpp"
+
+#include "chains.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+using namespace kine;
+using namespace kine::test;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    size_t bruteForceNearest(const WorkspaceIndex& index, const Vector3& target) {
+
+        size_t best = 0;
+        for (size_t i = 1; i < index.size(); ++i) {
+            if (index.position(i).distanceToSquared(target) < index.position(best).distanceToSquared(target)) best = i;
+        }
+        return best;
+    }
+
+}// namespace
+
+TEST_CASE("Index positions are the FK of their configurations") {
+
+    const auto kine = sevenDofChain();
+    const auto index = WorkspaceIndex::build(kine, 5000);
+    REQUIRE(index.size() == 5000);
+    REQUIRE(index.numDof() == kine.numDof());
+
+    for (size_t i = 0; i < index.size(); i += 97) {
+        const auto c = index.configuration(i);
+        Vector3 p;
+        p.setFromMatrixPosition(kine.calculateEndEffectorTransformation(std::vector<float>(c.begin(), c.end())));
+        CHECK_THAT(p.distanceTo(index.position(i)), WithinAbs(0, 1e-4));
+    }
+}
+
+TEST_CASE("Nearest matches brute force") {
+
+    const auto kine = sevenDofChain();
+    const auto index = WorkspaceIndex::build(kine, 20000);
+
+    for (const auto& target : reachableTargets(kine, 200, 5)) {
+        const size_t nearest = index.nearest(target);
+        CHECK(index.position(nearest).distanceToSquared(target) == index.position(bruteForceNearest(index, target)).distanceToSquared(target));
+
+        std::vector<float> seed(kine.numDof());
+        CHECK(index.seed(target, seed) == index.position(nearest).distanceTo(target));
+        const auto c = index.configuration(nearest);
+        CHECK(seed == std::vector<float>(c.begin(), c.end()));
+    }
+}
+
+TEST_CASE("Saved index loads for its own chain only") {
+
+    const auto kine = sevenDofChain();
+    const auto index = WorkspaceIndex::build(kine, 3000);
+    const auto path = std::filesystem::temp_directory_path() / "kine_test_workspace.idx";
+    index.save(path);
+
+    {
+        const auto loaded = WorkspaceIndex::load(path, kine);
+        REQUIRE(loaded.size() == index.size());
+        for (const auto& target : reachableTargets(kine, 50, 5)) {
+            CHECK(loaded.nearest(target) == index.nearest(target));
+        }
+    }
+
+    const auto other = KineBuilder().addRevoluteJoint(Vector3::Y(), {-180.f, 180.f}).addLink(Vector3::Y()).build();
+    CHECK_THROWS_AS(WorkspaceIndex::load(path, other), std::runtime_error);
+
+    std::filesystem::resize_file(path, 1000);
+    CHECK_THROWS_AS(WorkspaceIndex::load(path, kine), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Open limits are sampled within a full turn of their bound") {
+
+    const auto kine = KineBuilder()
+                              .addRevoluteJoint(Vector3::Z(), KineLimit(std::nullopt, 30.f))
+                              .addLink(Vector3::X())
+                              .addRevoluteJoint(Vector3::Z(), KineLimit(100.f, std::nullopt))
+                              .addLink(Vector3::X())
+                              .build();
+    const auto index = WorkspaceIndex::build(kine, 1000);
+    for (size_t i = 0; i < index.size(); ++i) {
+        const auto c = index.configuration(i);
+        CHECK(c[0] >= -330.f);
+        CHECK(c[0] <= 30.f);
+        CHECK(c[1] >= 100.f);
+        CHECK(c[1] <= 460.f);
+    }
+
+    const auto prismatic = KineBuilder().addPrismaticJoint(Vector3::X(), KineLimit(0.f, std::nullopt)).build();
+    CHECK_THROWS_AS(WorkspaceIndex::build(prismatic, 10), std::invalid_argument);
+
+    const auto inverted = KineBuilder().addRevoluteJoint(Vector3::Z(), {90.f, -90.f}).addLink(Vector3::X()).build();
+    CHECK_THROWS_AS(WorkspaceIndex::build(inverted, 10), std::invalid_argument);
+}